@@ -124,6 +124,26 @@ class IntervalTree {
     if (ub(e) <= key) return false;
     return true;
   }
+  // Returns the lowest entry that intersects [lo, hi), or end() if there
+  // is none. Entries are assumed not to overlap each other, so the
+  // remaining intersecting entries follow in order while their lower
+  // bound is below hi.
+  const_iterator firstOverlap(K lo, K hi) const {
+    if (!(lo < hi)) return tree_.end();
+    c_iter iter = tree_.upper_bound(lo);
+    if (iter != tree_.begin()) {
+      c_iter prev = iter;
+      --prev;
+      if (lo < prev->second.first) return prev;
+    }
+    if (iter != tree_.end() && iter->first < hi) return iter;
+    return tree_.end();
+  }
+
+  bool overlaps(K lo, K hi) const {
+    return firstOverlap(lo, hi) != tree_.end();
+  }
+
   void elements(std::vector<Entry> &buffer) const {
     buffer.clear();
     for (c_iter iter = tree_.begin();
@@ -60,6 +60,7 @@ namespace NS_aarch64 {
 #define BOp             0x05
 #define BCondOp         0x2A
 #define BRegOp          0xD61F
+#define CBNZOp          0x35
 #define NOOP            0xD503201F
 
 #define ADDShiftOp      0x2B
@@ -87,8 +88,12 @@ namespace NS_aarch64 {
 
 #define LDRSWImmUIOp    0xE6
 
+#define LDXROp          0x042
+#define STXROp          0x040
+
 #define MSROp           0xD51
 #define MRSOp           0xD53
+#define TPIDR_EL0SysReg 0x5E82
 #define MSROp           0xD51
 #define MOVSPOp         0x44000
 
@@ -47,6 +47,7 @@
 class BPatch_typeCollection;
 class BPatch_libInfo;
 class BPatch_module;
+class BPatch_selfProcess;
 class PCProcess;
 class PCThread;
 class PCEventHandler;
@@ -149,6 +150,24 @@ class BPATCH_DLL_EXPORT BPatch {
     bool saveFloatingPointsOn;
     bool forceSaveFloatingPointsOn;
 
+    /* If true, 'var = var +/- const' snippets are emitted as locked
+       read-modify-write updates so that counters shared between
+       threads do not lose increments.  Defaults to false */
+    bool atomicCountersOn_;
+
+    /* If true, binary rewriting lays relocated functions out in their
+       original order, skips springboards the CFG shows are unneeded,
+       and points unrelocated direct calls at the relocated copies.
+       Defaults to false */
+    bool directInstrumentationOn_;
+
+    /* If true, rewriting a dynamic executable links the runtime
+       library objects its instrumentation uses into the new binary
+       instead of adding a dependency on the shared runtime library.
+       Falls back to the shared library when the link is not possible.
+       Defaults to false */
+    bool staticRuntimeLinkingOn_;
+
     /* If true, we will use liveness calculations to avoid saving
        registers on platforms that support it. 
        Defaults to true. */
@@ -307,6 +326,18 @@ public:
     // returns whether base tramp and mini-tramp is merged
     bool isForceSaveFPROn();        
 
+    // BPatch::isAtomicCountersOn:
+    // returns whether counter updates are emitted as atomic increments
+    bool isAtomicCountersOn();
+
+    // BPatch::isDirectInstrumentationOn:
+    // returns whether rewritten binaries bypass springboards where possible
+    bool isDirectInstrumentationOn();
+
+    // BPatch::isStaticRuntimeLinkingOn:
+    // returns whether rewritten dynamic executables link the runtime in
+    bool isStaticRuntimeLinkingOn();
+
 
     // BPatch::hasForcedRelocation_NP:
     // returns whether all instrumented functions will be relocated
@@ -512,6 +543,24 @@ public:
 
     void forceSaveFPR(bool x);
 
+    //  BPatch::setAtomicCounters:
+    //  Turn on/off atomic (locked) increments for counter snippets
+    
+
+    void setAtomicCounters(bool x);
+
+    //  BPatch::setDirectInstrumentation:
+    //  Turn on/off springboard-free layout for binary rewriting
+    
+
+    void setDirectInstrumentation(bool x);
+
+    //  BPatch::setStaticRuntimeLinking:
+    //  Turn on/off linking runtime library objects into rewritten executables
+    
+
+    void setStaticRuntimeLinking(bool x);
+
 
     //  BPatch::setForcedRelocation_NP:
     //  Turn on/off forced relocation of instrumted functions
@@ -567,6 +616,13 @@ public:
     
                BPatch_binaryEdit * openBinary(const char *path, bool openDependencies = false);
 
+    // BPatch::openSelf
+    // Instrument the calling process from within, without a separate
+    // mutator process or ptrace. Requires DYNINSTAPI_RT_LIB, as for
+    // processCreate; the RT library is loaded into this process.
+
+    BPatch_selfProcess * openSelf(BPatch_hybridMode mode = BPatch_normalMode);
+
     // BPatch::createEnum:
     // Create Enum types. 
     
@@ -84,7 +84,7 @@ class instPoint;
 class int_variable;
 
 typedef enum{
-  TRADITIONAL_PROCESS, STATIC_EDITOR
+  TRADITIONAL_PROCESS, STATIC_EDITOR, SELF_PROCESS
 } processType;
 
 
@@ -137,6 +137,16 @@ class BPATCH_DLL_EXPORT BPatchSnippetHandle {
   thread_iter getCatchupThreads_end();
 
   BPatch_Vector<BPatch_thread *> & getCatchupThreads();
+
+  // Returns whether the snippet was inserted with insertSwitchableSnippet
+  bool isSwitchable();
+
+  // Turn a switchable snippet on or off with a single write to its
+  // enable flag; the instrumentation itself is left in place.  A
+  // running process is written in place where the OS allows it (Linux);
+  // elsewhere the process must be stopped.
+  bool setEnabled(bool enabled);
+  bool isEnabled();
   
 };
 
@@ -153,6 +163,7 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
   friend class BPatch_funcCallExpr;
   friend class BPatch_eventMailbox;
   friend class BPatch_instruction;
+  friend class BPatch_memoryTrace;
   friend Dyninst::PatchAPI::PatchMgrPtr Dyninst::PatchAPI::convert(const BPatch_addressSpace *);
   
  public:
@@ -181,6 +192,10 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
 
   BPatch_Vector<batchInsertionRecord *> *pendingInsertions;
 
+  // Frees enable flags of switchable snippets deleted during an insertion
+  // set; called once finalizeInsertionSet has removed their instances
+  void freeDeletedSwitchableFlags();
+
   BPatch_image *image;
 
   //  AddressSpace * as;
@@ -246,7 +261,26 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
 					      BPatch_callWhen when,
 					      BPatch_snippetOrder order = BPatch_firstSnippet);
 
+  //  BPatch_addressSpace::insertSwitchableSnippet
+  //
+  //  Insert code guarded by a mutatee flag so that it can be turned on
+  //  and off through BPatchSnippetHandle::setEnabled without relocation
 
+  BPatchSnippetHandle * insertSwitchableSnippet(const BPatch_snippet &expr,
+						BPatch_point &point,
+						BPatch_callWhen when = BPatch_callUnset,
+						BPatch_snippetOrder order = BPatch_firstSnippet,
+						bool enabled = true);
+
+  //  BPatch_addressSpace::insertSwitchableSnippet
+  //
+  //  As above, at multiple points sharing a single flag
+
+  BPatchSnippetHandle * insertSwitchableSnippet(const BPatch_snippet &expr,
+						const BPatch_Vector<BPatch_point *> &points,
+						BPatch_callWhen when = BPatch_callUnset,
+						BPatch_snippetOrder order = BPatch_firstSnippet,
+						bool enabled = true);
 
   
   virtual void beginInsertionSet() = 0;
@@ -365,6 +399,17 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
   //  Allocate memory for a new variable in the mutatee process
   
   BPatch_variableExpr * malloc(const BPatch_type &type, std::string name = std::string(""));
+
+  //  BPatch_addressSpace::mallocPerThread
+  //
+  //  Allocate an array of <maxThreads> elements of <type>, one per thread.
+  //  Index it with BPatch_threadIndexExpr, e.g.
+  //    BPatch_arithExpr(BPatch_ref, *array, BPatch_threadIndexExpr())
+  //  Threads whose index is maxThreads or more must be filtered out by the
+  //  caller.
+
+  BPatch_variableExpr * mallocPerThread(const BPatch_type &type, unsigned maxThreads,
+                                        std::string name = std::string(""));
   
   BPatch_variableExpr * createVariable(Dyninst::Address at_addr, 
 				       BPatch_type *type,
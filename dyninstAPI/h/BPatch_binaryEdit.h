@@ -105,6 +105,15 @@ class BPATCH_DLL_EXPORT BPatch_binaryEdit : public BPatch_addressSpace {
     // BPatch_binaryEdit::writeFile
     bool writeFile(const char * outFile);
 
+    // BPatch_binaryEdit::loadLayoutProfile
+    //
+    //  Read block (and optionally edge) execution counts for the original
+    //  binary; relocated code written by writeFile is then laid out
+    //  hot-first. Each line is "<addr> <count>" or "<src> <dst> <count>"
+    //  with hex, object-relative block start addresses.
+
+    bool loadLayoutProfile(const char *profileFile);
+
   
     //  BPatch_binaryEdit::~BPatch_binaryEdit
     //
@@ -84,6 +84,7 @@ class BPATCH_DLL_EXPORT BPatch_image: public BPatch_sourceObj {
   friend class BPatch_process;
   friend class BPatch_addressSpace;
   friend class BPatch_binaryEdit;
+  friend class BPatch_selfProcess;
   friend Dyninst::PatchAPI::PatchMgrPtr Dyninst::PatchAPI::convert(const BPatch_image *);
 
   BPatch_variableExpr *findOrCreateVariable(int_variable *);
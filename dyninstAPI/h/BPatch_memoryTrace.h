@@ -0,0 +1,145 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef _BPatch_memoryTrace_h_
+#define _BPatch_memoryTrace_h_
+
+#include <set>
+#include <vector>
+#include "BPatch_dll.h"
+#include "BPatch_Vector.h"
+
+class BPatch_addressSpace;
+class BPatch_function;
+class BPatch_point;
+class BPatch_variableExpr;
+class BPatchSnippetHandle;
+
+/*
+ * One entry of a memory trace, as laid out in the mutatee.  A record made
+ * from several coalesced accesses covers their combined footprint and
+ * carries the address of the first instruction in the group.
+ */
+struct BPatch_memoryTraceRecord {
+    unsigned long pc;
+    unsigned long address;
+    unsigned long size;
+};
+
+/*
+ * Records the (pc, address, size) of every load and store in the
+ * instrumented functions into a per-thread buffer in the mutatee.  The
+ * append is emitted inline at each access and never calls out.  The
+ * optional flush function is called at the exits and loop heads of the
+ * instrumented functions once a thread's buffer is at least half full, as
+ *
+ *     void flush(const struct BPatch_memoryTraceRecord *records, int count);
+ *
+ * after which the buffer is reused from the start; accesses that find the
+ * buffer full before the next flush are counted as dropped, which only
+ * happens when more than half a buffer is recorded between two checks.  Without a
+ * flush function a full buffer restarts from the beginning, so only the
+ * records since the last restart are available.
+ */
+class BPATCH_DLL_EXPORT BPatch_memoryTrace {
+    BPatch_addressSpace *as_;
+    BPatch_function *flush_;
+    BPatch_variableExpr *records_;
+    BPatch_variableExpr *cursors_;
+    unsigned recordsPerThread_;
+    unsigned maxThreads_;
+    unsigned long accessPoints_;
+    unsigned long appendSites_;
+    BPatch_Vector<BPatchSnippetHandle *> handles_;
+    std::set<BPatch_function *> flushed_;
+
+    bool insertAppend(BPatch_point *point, int which, long adjust, long size);
+    bool insertFlush(BPatch_function *func);
+
+public:
+
+    //  BPatch_memoryTrace::BPatch_memoryTrace
+    //  Allocates <recordsPerThread> records for each of <maxThreads> thread
+    //  indices.  <flush> may be NULL.
+    BPatch_memoryTrace(BPatch_addressSpace *as,
+                       unsigned recordsPerThread = 1024,
+                       unsigned maxThreads = 32,
+                       BPatch_function *flush = NULL);
+    ~BPatch_memoryTrace();
+
+    //  BPatch_memoryTrace::isValid
+    //  False if the trace state could not be allocated in the mutatee
+    bool isValid() const { return records_ != NULL && cursors_ != NULL; }
+
+    //  BPatch_memoryTrace::instrumentFunction
+    //  Traces every load and store in <func>.  With <coalesce>, runs of
+    //  accesses in a basic block that share a base register and touch
+    //  adjacent or overlapping bytes are recorded once.
+    bool instrumentFunction(BPatch_function *func, bool coalesce = true);
+
+    //  BPatch_memoryTrace::remove
+    //  Removes all instrumentation inserted by this trace; the buffers
+    //  stay allocated until the trace is destroyed
+    bool remove();
+
+    //  BPatch_memoryTrace::getRecords
+    //  Reads the records currently buffered for thread index <thread>.
+    //  Only available when the mutatee is a live process.
+    bool getRecords(unsigned thread,
+                    std::vector<BPatch_memoryTraceRecord> &records);
+
+    //  BPatch_memoryTrace::getDropped
+    //  Number of accesses thread index <thread> could not record because
+    //  its buffer was full and waiting for a flush.  Only available when
+    //  the mutatee is a live process.
+    bool getDropped(unsigned thread, unsigned &dropped);
+
+    //  BPatch_memoryTrace::getRecordsVar
+    //  The mutatee array holding every thread's records
+    BPatch_variableExpr *getRecordsVar() const { return records_; }
+
+    //  BPatch_memoryTrace::getCursorsVar
+    //  The mutatee array holding each thread's record and dropped counts
+    BPatch_variableExpr *getCursorsVar() const { return cursors_; }
+
+    unsigned getRecordsPerThread() const { return recordsPerThread_; }
+    unsigned getMaxThreads() const { return maxThreads_; }
+
+    //  BPatch_memoryTrace::getAccessPoints
+    //  Number of memory accesses found by instrumentFunction
+    unsigned long getAccessPoints() const { return accessPoints_; }
+
+    //  BPatch_memoryTrace::getAppendSites
+    //  Number of inline appends inserted; lower than getAccessPoints when
+    //  accesses were coalesced
+    unsigned long getAppendSites() const { return appendSites_; }
+};
+
+#endif /* _BPatch_memoryTrace_h_ */
@@ -296,6 +296,14 @@ public:
 
     bool usesTrap_NP();
 
+    //  BPatch_point::getSavedRegisterCount_NP
+    //  Returns the number of general purpose registers saved by the most
+    //  recently generated base tramp at this point, or -1 if no base tramp
+    //  has been generated yet.
+
+
+    int getSavedRegisterCount_NP();
+
 #ifdef IBM_BPATCH_COMPAT
     void *getPointAddress() { return getAddress(); }
     int getPointLine() { return -1; }
@@ -61,6 +61,7 @@ class BPatch_instpMap;
 class func_instance;
 class rpcMgr;
 class HybridAnalysis;
+class BPatch_traceBuffer;
 struct batchInsertionRecord;
 
 typedef enum {
@@ -148,6 +149,7 @@ class BPATCH_DLL_EXPORT BPatch_process : public BPatch_addressSpace {
   friend class AstOperatorNode;
   friend class AstMemoryNode;
   friend class PCEventHandler; // to deliver events for callbacks
+  friend class BPatch_traceBuffer;
 
  protected:
   void getAS(std::vector<AddressSpace *> &as);
@@ -161,6 +163,8 @@ class BPATCH_DLL_EXPORT BPatch_process : public BPatch_addressSpace {
 
   BPatch_Vector<BPatch_thread *> threads;
 
+  std::vector<BPatch_traceBuffer *> traceBuffers;
+
   int lastSignal;
   int exitCode;
   int exitSignal;
@@ -476,6 +480,25 @@ class BPATCH_DLL_EXPORT BPatch_process : public BPatch_addressSpace {
 
   virtual BPatch_object * loadLibrary(const char *libname, bool reload = false);
 
+  // BPatch_process::getTrapCounts
+  //
+  //  For each trap-based springboard the mutatee has taken, the address of
+  //  the trap and how many times it fired.  Useful for finding transfers
+  //  worth turning into jumps.
+
+  bool getTrapCounts(std::vector<std::pair<Dyninst::Address, unsigned long> > &counts);
+
+  // BPatch_process::createTraceBuffer
+  //
+  //  Create a set of per-thread trace rings shared with the mutatee, each
+  //  holding <recordsPerThread> records of <recordWords> 64-bit words, for
+  //  thread indices below <maxThreads>.  Returns NULL on failure; the
+  //  buffer lives as long as the process.
+
+  BPatch_traceBuffer *createTraceBuffer(unsigned recordWords,
+                                        unsigned recordsPerThread,
+                                        unsigned maxThreads = 64);
+
   bool supportsUserThreadEvents();
 
 };
@@ -0,0 +1,106 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef _BPatch_selfProcess_h_
+#define _BPatch_selfProcess_h_
+
+#include "BPatch_dll.h"
+#include "BPatch_Vector.h"
+#include "BPatch_image.h"
+#include "BPatch_addressSpace.h"
+
+#include <vector>
+
+class SelfProcess;
+class AddressSpace;
+class BPatch;
+
+// The process Dyninst is running in, instrumented from the inside.
+// Instrumentation is generated into memory mapped near the code it
+// patches and installed with direct writes; the process is never
+// stopped or traced, so unlike BPatch_process there are no threads,
+// callbacks, or one-time code.
+
+class BPATCH_DLL_EXPORT BPatch_selfProcess : public BPatch_addressSpace {
+    friend class BPatch;
+
+ private:
+    SelfProcess *llself;
+    bool creation_error;
+
+    BPatch_selfProcess(BPatch_hybridMode mode);
+
+ public:
+    void getAS(std::vector<AddressSpace *> &as);
+
+    SelfProcess *lowlevel_self() const { return llself; }
+
+    processType getType();
+    bool getTerminated() { return false; }
+    bool getMutationsActive() { return true; }
+
+    //  BPatch_selfProcess::~BPatch_selfProcess
+    //
+    //  Destructor; instrumentation already installed stays in place
+    ~BPatch_selfProcess();
+
+    //  BPatch_selfProcess::beginInsertionSet
+    //
+    //  Start the batch insertion of multiple points; all calls to insertSnippet*
+    //  after this call will not actually instrument until finalizeInsertionSet is
+    //  called
+
+    void beginInsertionSet();
+
+    //  BPatch_selfProcess::finalizeInsertionSet
+    //
+    //  Relocates the modified functions and installs their springboards.
+    //  Other threads keep running; a springboard that fits in one aligned
+    //  word is written with a single store, and longer ones behind a
+    //  temporary trap that sends threads reaching it back to retry.
+
+    bool finalizeInsertionSet(bool atomic, bool *modified = NULL);
+
+    //  BPatch_selfProcess::loadLibrary
+    //
+    //  dlopen a library into this process and make it available for
+    //  instrumentation
+
+    virtual BPatch_object * loadLibrary(const char *libname, bool reload = false);
+
+    //  BPatch_selfProcess::updateObjects
+    //
+    //  Pick up libraries the application has loaded itself since the
+    //  BPatch_selfProcess was created
+
+    bool updateObjects();
+};
+
+#endif /* _BPatch_selfProcess_h_ */
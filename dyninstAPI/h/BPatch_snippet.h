@@ -644,6 +644,34 @@ class BPATCH_DLL_EXPORT BPatch_scrambleRegistersExpr : public BPatch_snippet
   BPatch_scrambleRegistersExpr();
 };
 
+class BPATCH_DLL_EXPORT BPatch_sampledExpr : public BPatch_snippet
+{
+ public:
+  //  BPatch_sampledExpr::BPatch_sampledExpr
+  //  Wraps <body> so that it executes only on every <period>th hit,
+  //  counted separately for each thread index below <maxThreads>.
+  //  Threads with a larger index never execute <body>.
+  BPatch_sampledExpr(BPatch_addressSpace *as, const BPatch_snippet &body,
+                     unsigned period, unsigned maxThreads = 256);
+
+  //  BPatch_sampledExpr::setPeriod
+  //  Changes the sampling period in the mutatee; existing instrumentation
+  //  picks up the new period when each thread's countdown next expires.
+  bool setPeriod(unsigned period);
+
+  //  BPatch_sampledExpr::getPeriod
+  unsigned getPeriod() const { return period; }
+
+  //  BPatch_sampledExpr::getPeriodVar
+  //  The mutatee variable holding the period
+  BPatch_variableExpr *getPeriodVar() const { return periodVar; }
+
+ private:
+  unsigned period;
+  BPatch_variableExpr *periodVar;
+  BPatch_variableExpr *counters;
+};
+
 #endif /* _BPatch_snippet_h_ */
 
 
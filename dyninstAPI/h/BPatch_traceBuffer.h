@@ -0,0 +1,123 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef _BPatch_traceBuffer_h_
+#define _BPatch_traceBuffer_h_
+
+#include <stddef.h>
+#include "BPatch_dll.h"
+#include "BPatch_Vector.h"
+
+class BPatch_process;
+class BPatch_snippet;
+class BPatch_function;
+class BPatch_variableExpr;
+class BPatch_traceBuffer;
+struct DYNINST_traceRing;
+
+/*
+ * Called by BPatch_traceBuffer::consume for each run of records found in a
+ * thread's ring.  <records> points directly into the shared buffer and holds
+ * <count> records of getRecordWords() 64-bit words each; it is only valid
+ * until the callback returns.
+ */
+typedef void (*BPatchTraceConsumer)(BPatch_traceBuffer *buf, unsigned ring,
+                                    const void *records, unsigned count,
+                                    void *arg);
+
+/*
+ * A set of per-thread, single-producer ring buffers shared between the
+ * mutator and the mutatee, one for each thread index.  Instrumentation
+ * appends records with the snippet from appendExpr(); the mutator drains
+ * them with consume() without stopping the process or making system calls.
+ * A ring passes to the next thread given its index once its thread exits.
+ */
+class BPATCH_DLL_EXPORT BPatch_traceBuffer {
+    friend class BPatch_process;
+
+    BPatch_process *proc_;
+    BPatch_function *appendFunc_;
+    int id_;
+    void *base_;
+    void *remote_;
+    size_t size_;
+    size_t ringBytes_;
+    unsigned recordWords_;
+    unsigned capacity_;
+    unsigned slots_;
+    unsigned numRings_;
+    // The mapping in the mutatee, as arrays of ints and of longs
+    BPatch_variableExpr *ints_;
+    BPatch_variableExpr *longs_;
+
+    BPatch_traceBuffer(BPatch_process *proc, int id, unsigned recordWords,
+                       unsigned capacity, unsigned numRings);
+    bool create();
+    ~BPatch_traceBuffer();
+    struct DYNINST_traceRing *ring(unsigned r) const;
+
+public:
+
+    //  BPatch_traceBuffer::getRecordWords
+    //  Number of 64-bit words per record (1 to 4)
+    unsigned getRecordWords() const { return recordWords_; }
+
+    //  BPatch_traceBuffer::getCapacity
+    //  Number of records each thread's ring can hold
+    unsigned getCapacity() const { return capacity_; }
+
+    //  BPatch_traceBuffer::getNumRings
+    //  Number of thread indices that can trace into this buffer
+    unsigned getNumRings() const { return numRings_; }
+
+    //  BPatch_traceBuffer::appendExpr
+    //  Returns a snippet that appends one record built from <words> (at most
+    //  getRecordWords() of them; missing words are zero) to the executing
+    //  thread's ring.  On x86 the append is emitted inline; elsewhere the
+    //  snippet calls DYNINSTtraceAppend.  The caller owns the returned
+    //  snippet.
+    BPatch_snippet *appendExpr(const BPatch_Vector<BPatch_snippet *> &words);
+
+    //  BPatch_traceBuffer::consume
+    //  Hands every pending record to <cb> and releases the space.  Returns
+    //  the number of records consumed.
+    unsigned consume(BPatchTraceConsumer cb, void *arg = NULL);
+
+    //  BPatch_traceBuffer::getDropped
+    //  Records discarded because a ring was full
+    unsigned long getDropped() const;
+
+    //  BPatch_traceBuffer::getUnserved
+    //  Records discarded because the appending thread's index was at least
+    //  getNumRings().  Concurrent inline appends may undercount.
+    unsigned long getUnserved() const;
+};
+
+#endif /* _BPatch_traceBuffer_h_ */
@@ -84,7 +84,12 @@ class CodeMover {
   static Ptr create(CodeTracker *);
   ~CodeMover();
 
-  bool addFunctions(FuncSet::const_iterator begin, FuncSet::const_iterator end);
+  // If requiredOnly is set (direct instrumentation), functions are laid
+  // out in original address order and blocks only get the springboards
+  // the CFG says they need (function entries, indirect targets, and
+  // targets of unrelocated code) instead of one per block.
+  bool addFunctions(FuncSet::const_iterator begin, FuncSet::const_iterator end,
+                    bool requiredOnly = false);
 
   // Apply the given Transformer to all blocks in the Mover
   bool transform(Transformer &t);
@@ -133,9 +138,9 @@ class CodeMover {
   
   void setAddr(Address &addr) { addr_ = addr; }
   template <typename RelocBlockIter>
-     bool addRelocBlocks(RelocBlockIter begin, RelocBlockIter end, func_instance *f);
+     bool addRelocBlocks(RelocBlockIter begin, RelocBlockIter end, func_instance *f, bool suggest);
 
-  bool addRelocBlock(block_instance *block, func_instance *f);
+  bool addRelocBlock(block_instance *block, func_instance *f, bool suggest);
 
   void finalizeRelocBlocks();
 
@@ -35,3 +35,4 @@
 #include "Modification.h"
 #include "Movement-adhoc.h"
 #include "Movement-analysis.h"
+#include "Layout.h"
@@ -0,0 +1,77 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_R_T_LAYOUT_H_)
+#define _R_T_LAYOUT_H_
+
+#include "Transformer.h"
+#include <map>
+#include <vector>
+
+class func_instance;
+
+namespace Dyninst {
+namespace Relocation {
+
+// Reorders relocated blocks and functions using execution counts.
+// Within a function, blocks are chained along their hottest edges
+// (Pettis-Hansen bottom-up positioning) with the entry chain first and
+// never-executed chains last. Functions are then laid out hottest
+// first, with unprofiled functions left in their original order at
+// the end. Counts are keyed by object-relative block start address.
+// Blocks missing from the block profile take their count from the
+// edge profile, so an edge-only profile is enough.
+
+class ProfileLayout : public Transformer {
+  public:
+    typedef std::map<Address, unsigned long> BlockCounts;
+    typedef std::map<std::pair<Address, Address>, unsigned long> EdgeCounts;
+
+    ProfileLayout(const BlockCounts &blocks, const EdgeCounts &edges);
+    virtual ~ProfileLayout() {};
+
+    virtual bool processGraph(RelocGraph *);
+    virtual bool process(RelocBlock *, RelocGraph *) { return true; }
+
+  private:
+    typedef std::vector<RelocBlock *> Chain;
+
+    unsigned long blockCount(RelocBlock *b) const;
+    unsigned long edgeCount(RelocBlock *s, RelocBlock *t) const;
+    void layoutFunction(std::vector<RelocBlock *> &blocks) const;
+
+    BlockCounts blocks_;
+    const EdgeCounts &edges_;
+};
+
+};
+};
+
+#endif
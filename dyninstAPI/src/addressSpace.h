@@ -356,6 +356,11 @@ class AddressSpace : public InstructionSource {
     // Trampoline guard get/set functions
     int_variable* trampGuardBase(void) { return trampGuardBase_; }
     AstNodePtr trampGuardAST(void);
+    // Offset of the RT tramp guard from the thread pointer, if the
+    // guard can be accessed inline
+    virtual bool getTrampGuardTPOffset(long &) { return false; }
+    // Likewise for the RT's per-thread index
+    virtual bool getThreadIndexTPOffset(long &) { return false; }
 
     // Get the current code generator (or emitter)
     Emitter *getEmitter();
@@ -493,7 +498,7 @@ class AddressSpace : public InstructionSource {
 
     // inferior malloc support functions
     void inferiorFreeCompact();
-    int findFreeIndex(unsigned size, int type, Address lo, Address hi);
+    heapItem *findFreeBlock(unsigned size, int type, Address lo, Address hi);
     void addHeap(heapItem *h);
     void initializeHeap();
     
@@ -530,6 +535,10 @@ class AddressSpace : public InstructionSource {
 
     bool relocateInt(FuncSet::const_iterator begin, FuncSet::const_iterator end, Address near);
     Dyninst::Relocation::InstalledSpringboards::Ptr installedSpringboards_;
+
+    // Where each function's entry springboard lands, newest relocation
+    // wins. Only tracked for binary rewriting.
+    std::map<func_instance *, Address> relocatedEntries_;
  public:
     Dyninst::Relocation::InstalledSpringboards::Ptr getInstalledSpringboards() 
     {
@@ -577,6 +586,5 @@ class AddressSpace : public InstructionSource {
 
 
 bool uninstrument(Dyninst::PatchAPI::Instance::Ptr);
-extern int heapItemCmpByAddr(const heapItem **A, const heapItem **B);
 
 #endif // ADDRESS_SPACE_H
@@ -240,6 +240,8 @@ class AstNode : public Dyninst::PatchAPI::Snippet {
    static AstNodePtr threadIndexNode();
 
    static AstNodePtr scrambleRegistersNode();
+
+   static AstNodePtr trampGuardNode(bool acquire, long tls_offset);
    
    // TODO...
    // Needs some way of marking what to save and restore... should be a registerSpace, really
@@ -247,7 +249,6 @@ class AstNode : public Dyninst::PatchAPI::Snippet {
 #if 0
    static AstNodePtr saveStateNode();
    static AstNodePtr restoreStateNode();
-   static AstNodePtr trampGuardNode();
 #endif
 
    static AstNodePtr miniTrampNode(AstNodePtr tramp);
@@ -310,7 +311,14 @@ class AstNode : public Dyninst::PatchAPI::Snippet {
 
 
    virtual bool containsFuncCall() const = 0;
+   // As above, but for code generated into a particular address space;
+   // nodes that only sometimes call out can give a sharper answer.
+   virtual bool containsFuncCallIn(AddressSpace *) const { return containsFuncCall(); }
    virtual bool usesAppRegister() const = 0;
+   // Conservative: returns false only if the generated code is known
+   // to leave the condition codes untouched (e.g., plain stores of
+   // constants), which lets base tramps skip saving the flags.
+   virtual bool clobbersFlags() const { return true; }
 
    enum CostStyleType { Min, Avg, Max };
    int minCost() const {  return costHelper(Min);  }
@@ -431,6 +439,7 @@ class AstNullNode : public AstNode {
    virtual std::string format(std::string indent);
     virtual bool containsFuncCall() const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
     
     bool canBeKept() const { return true; }
  private:
@@ -517,6 +526,7 @@ class AstLabelNode : public AstNode {
     AstLabelNode(std::string &label) : AstNode(), label_(label), generatedAddr_(0) {};
     virtual bool containsFuncCall() const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
 
 	bool canBeKept() const { return true; }
  private:
@@ -553,7 +563,9 @@ class AstOperatorNode : public AstNode {
     virtual AstNodePtr deepCopy();
 
     virtual bool containsFuncCall() const;
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
  
 
     // We override initRegisters in the case of writing to an original register.
@@ -628,8 +640,10 @@ class AstOperandNode : public AstNode {
     virtual void setVariableAST(codeGen &gen);
 
     virtual bool containsFuncCall() const;
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
 
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
  
     virtual void emitVariableStore(opCode op, Register src1, Register src2, codeGen& gen, 
 			   bool noCost, registerSpace* rs, 
@@ -730,7 +744,9 @@ class AstSequenceNode : public AstNode {
 
     virtual void setVariableAST(codeGen &gen);
     virtual bool containsFuncCall() const;
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
  
 
  private:
@@ -768,7 +784,9 @@ class AstVariableNode : public AstNode {
     virtual AstNodePtr deepCopy();
 
     virtual bool containsFuncCall() const;
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
  
 
  private:
@@ -810,7 +828,9 @@ class AstMiniTrampNode : public AstNode {
     virtual void setVariableAST(codeGen &gen);
 
     virtual bool containsFuncCall() const;
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
     virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const;
  
 
     bool canBeKept() const;
@@ -901,6 +921,65 @@ class AstDynamicTargetNode : public AstNode {
                                      Address &retAddr,
                                      Register &retReg);
 };
+
+// The RT's per-thread index.  Where the RT has published its TLS offset
+// this is a thread-pointer-relative load, with a call into the RT only the
+// first time a thread runs it; otherwise it is a plain call to
+// DYNINSTthreadIndex.
+class AstThreadIndexNode : public AstNode {
+ public:
+    AstThreadIndexNode(AstNodePtr call) : call_(call) {};
+
+    virtual ~AstThreadIndexNode() {};
+
+    virtual bool canBeKept() const { return true; }
+    // Only the out-of-line fallback is a call the tramp must save for
+    virtual bool containsFuncCall() const { return true; }
+    virtual bool containsFuncCallIn(AddressSpace *as) const;
+    virtual bool usesAppRegister() const { return false; }
+    virtual bool initRegisters(codeGen &gen);
+
+    virtual void getChildren(pdvector<AstNodePtr> &children);
+    virtual void setChildren(pdvector<AstNodePtr> &children);
+
+ private:
+    virtual bool generateCode_phase2(codeGen &gen,
+                                     bool noCost,
+                                     Address &retAddr,
+                                     Register &retReg);
+    static bool canInline(AddressSpace *as, long &tls_offset,
+                          Address &slow_path);
+
+    AstNodePtr call_;
+};
+
+// Inline take/release of the RT library's per-thread tramp guard, which
+// lives at a fixed offset from the thread pointer.  Acquiring yields the
+// old guard value (non-zero if we got it) and clears the guard.
+class AstTrampGuardNode : public AstNode {
+ public:
+    AstTrampGuardNode(bool acquire, long tls_offset) :
+       acquire_(acquire), tls_offset_(tls_offset) {};
+
+    virtual ~AstTrampGuardNode() {};
+
+    virtual bool canBeKept() const { return false; }
+    virtual bool containsFuncCall() const;
+    virtual bool usesAppRegister() const;
+    virtual bool clobbersFlags() const { return false; }
+
+    // True, with the guard's offset, if as can take the guard inline
+    static bool canInline(AddressSpace *as, long &tls_offset);
+
+ private:
+    virtual bool generateCode_phase2(codeGen &gen,
+                                     bool noCost,
+                                     Address &retAddr,
+                                     Register &retReg);
+    bool acquire_;
+    long tls_offset_;
+};
+
 class AstScrambleRegistersNode : public AstNode {
  public:
     AstScrambleRegistersNode() {};
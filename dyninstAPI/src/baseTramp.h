@@ -69,6 +69,7 @@ class baseTramp {
                              Address baseInMutatee);
 
     bool checkForFuncCalls();
+    bool clobbersFlags();
 
     ~baseTramp();
 
@@ -112,6 +113,7 @@ class baseTramp {
     int  stackHeight;
     bool skippedRedZone;
     bool wasFullFPRSave;
+    int  numSavedRegs;
     
     
     bool validOptimizationInfo() { return optimizationInfo_; }
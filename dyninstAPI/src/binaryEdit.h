@@ -185,8 +185,19 @@ class BinaryEdit : public AddressSpace {
    mapped_object *openResolvedLibraryName(std::string filename, 
                                           std::map<std::string, BinaryEdit*> &allOpened);
 
+   // Open the static runtime library to link into this (dynamic) binary
+   bool openRuntimeArchive(const std::string &rtSharedName);
+   bool linksRuntimeStatically() const { return rtArchive_ != NULL; }
+
    bool writing() { return writing_; }
 
+   // Block and edge execution counts (object-relative addresses) used
+   // to lay out relocated code hot-first
+   bool loadLayoutProfile(const std::string &file);
+   bool hasLayoutProfile() const { return !layoutBlockCounts_.empty() || !layoutEdgeCounts_.empty(); }
+   const std::map<Address, unsigned long> &layoutBlockCounts() const { return layoutBlockCounts_; }
+   const std::map<std::pair<Address, Address>, unsigned long> &layoutEdgeCounts() const { return layoutEdgeCounts_; }
+
    void addDyninstSymbol(SymtabAPI::Symbol *sym) { newDyninstSyms_.push_back(sym); }
 
    virtual void addTrap(Address from, Address to, codeGen &gen);
@@ -216,6 +227,15 @@ class BinaryEdit : public AddressSpace {
 
    /* Function specific to rewritting static binaries */
    bool doStaticBinarySpecialCases();
+
+   // Retarget direct calls in unrelocated code at relocated callees
+   void redirectCallsToRelocated();
+
+   /* Functions specific to linking the runtime into a dynamic binary */
+   bool canLinkRuntime(SymtabAPI::Symtab *symObj);
+   bool addStaticRuntimeInit();
+   bool isRuntimeSymbol(SymtabAPI::Symbol *sym);
+   SymtabAPI::Symbol *findRuntimeArchiveSymbol(const std::string &name);
     
     codeRangeTree* memoryTracker_;
 
@@ -228,10 +248,14 @@ class BinaryEdit : public AddressSpace {
                              SymtabAPI::Module *newMod);
     mapped_object *mobj;
     std::vector<BinaryEdit *> rtlib;
+    SymtabAPI::Archive *rtArchive_;
     std::vector<BinaryEdit *> siblings;
     bool multithread_capable_;
     bool writing_;
 
+    std::map<Address, unsigned long> layoutBlockCounts_;
+    std::map<std::pair<Address, Address>, unsigned long> layoutEdgeCounts_;
+
     // Symbols that other people (e.g., functions) want us to add
     std::vector<SymtabAPI::Symbol *> newDyninstSyms_;
 
@@ -109,6 +109,17 @@ public:
     static void generateMemAccessFP(codeGen &gen, LoadStore accType, Register rt,
             Register rn, int immd, int size, bool is128bit, IndexMode im=Offset);
 
+    // LDXR/STXR; rs receives the store status and is ignored for loads
+    static void generateMemAccessExclusive(codeGen &gen, LoadStore accType,
+            Register rs, Register rt, Register rn, unsigned size);
+
+    // CBNZ to a word offset relative to this instruction
+    static void generateCompareBranchNonZero(codeGen &gen, Register rt,
+            int word_off, bool is64bit);
+
+    // MRS rt, <sysreg>, with sysreg given as its 15-bit encoding
+    static void generateMoveFromSysReg(codeGen &gen, Register rt, unsigned sysreg);
+
     template<typename T>
     static void loadImmIntoReg(codeGen &gen, Register rt, T value);
 
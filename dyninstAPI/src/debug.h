@@ -96,6 +96,10 @@ extern const std::string INST_GENERATE_COUNTER;
 extern const std::string INST_INSTALL_COUNTER;
 extern const std::string INST_LINK_COUNTER;
 extern const std::string INST_REMOVE_COUNTER;
+extern const std::string INST_MALLOC_COUNTER;
+extern const std::string INST_FREE_COUNTER;
+extern const std::string INST_REALLOC_COUNTER;
+extern const std::string INST_MALLOC_SEARCH_COUNTER;
 
 extern const std::string PTRACE_WRITE_TIMER;
 extern const std::string PTRACE_WRITE_COUNTER;
@@ -111,6 +115,9 @@ extern const std::string CODEGEN_AST_TIMER;
 extern const std::string CODEGEN_AST_COUNTER;
 extern const std::string CODEGEN_REGISTER_TIMER;
 extern const std::string CODEGEN_LIVENESS_TIMER;
+extern const std::string CODEGEN_SAVED_REGS_COUNTER;
+extern const std::string CODEGEN_SAVED_FLAGS_COUNTER;
+extern const std::string CODEGEN_SAVED_FPRS_COUNTER;
 
 // C++ prototypes
 #define signal_cerr       if (dyn_debug_signal) cerr
@@ -125,6 +125,10 @@ public:
                         u_int amount, const void *inSelf);
     bool writeDataWord(void *inTracedProcess,
                        u_int amount, const void *inSelf);
+    // Write without stopping the process; platform-specific, and false
+    // where the OS cannot write into a running process
+    bool writeDataSpaceRunning(void *inTracedProcess,
+                               u_int amount, const void *inSelf);
     bool readDataSpace(const void *inTracedProcess, u_int amount,
                        void *inSelf, bool displayErrMsg);
     bool readDataWord(const void *inTracedProcess, u_int amount,
@@ -152,6 +156,7 @@ public:
     void getThreads(std::vector<PCThread* > &threads) const;
     void addThread(PCThread *thread);
     bool removeThread(dynthread_t tid);
+    void releaseThreadIndex(PCThread *thread);
 
     int getPid() const;
     unsigned getAddressWidth() const;
@@ -290,6 +295,8 @@ public:
     virtual bool multithread_capable(bool ignoreIfMtNotSet = false); // platform-specific
     virtual bool multithread_ready(bool ignoreIfMtNotSet = false);
     virtual bool needsPIC();
+    virtual bool getTrampGuardTPOffset(long &off);
+    virtual bool getThreadIndexTPOffset(long &off);
     //virtual bool unregisterTrapMapping(Address from);
     virtual void addTrap(Address from, Address to, codeGen &gen);
     virtual void removeTrap(Address from);
@@ -355,6 +362,10 @@ protected:
           sync_event_arg3_addr_(0),
           sync_event_breakpoint_addr_(0),
           rt_trap_func_addr_(0),
+          tramp_guard_tpoff_(0),
+          tramp_guard_tpoff_valid_(false),
+          thread_index_tpoff_(0),
+          thread_index_tpoff_valid_(false),
        thread_hash_tids(0),
        thread_hash_indices(0),
        thread_hash_size(0),
@@ -396,6 +407,10 @@ protected:
           sync_event_arg3_addr_(0),
           sync_event_breakpoint_addr_(0),
           rt_trap_func_addr_(0),
+          tramp_guard_tpoff_(0),
+          tramp_guard_tpoff_valid_(false),
+          thread_index_tpoff_(0),
+          thread_index_tpoff_valid_(false),
        thread_hash_tids(0),
        thread_hash_indices(0),
        thread_hash_size(0),
@@ -440,6 +455,10 @@ protected:
           sync_event_arg3_addr_(parent->sync_event_arg3_addr_),
           sync_event_breakpoint_addr_(parent->sync_event_breakpoint_addr_),
           rt_trap_func_addr_(parent->rt_trap_func_addr_),
+          tramp_guard_tpoff_(parent->tramp_guard_tpoff_),
+          tramp_guard_tpoff_valid_(parent->tramp_guard_tpoff_valid_),
+          thread_index_tpoff_(parent->thread_index_tpoff_),
+          thread_index_tpoff_valid_(parent->thread_index_tpoff_valid_),
        thread_hash_tids(parent->thread_hash_tids),
        thread_hash_indices(parent->thread_hash_indices),
        thread_hash_size(parent->thread_hash_size),
@@ -492,6 +511,8 @@ protected:
     Address getRTEventArg2Addr();
     Address getRTEventArg3Addr();
     Address getRTTrapFuncAddr();
+    bool getTPOffset(const char *var, long &cached, bool &valid, long &off);
+    void pushFreeThreadIndex(PCThread *thread);
 
     // Shared library managment
     void addASharedObject(mapped_object *newObj);
@@ -598,6 +619,10 @@ protected:
     Address sync_event_arg3_addr_;
     Address sync_event_breakpoint_addr_;
     Address rt_trap_func_addr_;
+    long tramp_guard_tpoff_;
+    bool tramp_guard_tpoff_valid_;
+    long thread_index_tpoff_;
+    bool thread_index_tpoff_valid_;
     Address thread_hash_tids;
     Address thread_hash_indices;
     int thread_hash_size;
@@ -148,7 +148,9 @@ public:
 
     virtual void emitStoreImm(Address, int, codeGen &, bool) { assert(0); }
 
-    virtual void emitAddSignedImm(Address, int, codeGen &, bool) { assert(0); }
+    virtual bool emitAddSignedImm(Address addr, int imm, int size, bool atomic, codeGen &gen, bool noCost);
+
+    virtual bool emitTLSGuard(bool acquire, long tls_offset, Register dest, codeGen &gen);
 
     virtual int Register_DWARFtoMachineEnc(int) {
         assert(0);
@@ -229,7 +231,8 @@ public:
 
     unsigned saveFPRegisters(codeGen &gen, registerSpace *theRegSpace, int offset);
 
-    unsigned saveSPRegisters(codeGen &gen, registerSpace *, int offset, bool force_save);
+    unsigned saveSPRegisters(codeGen &gen, registerSpace *, int offset, bool force_save,
+            bool save_flags = true);
 
     void createFrame(codeGen &gen);
 
@@ -106,7 +106,7 @@ class EmitterPOWER : public Emitter {
     virtual bool emitBTSaves(baseTramp*, codeGen &) { assert(0); return true;}
     virtual bool emitBTRestores(baseTramp*, codeGen &) { assert(0); return true; }
     virtual void emitStoreImm(Address, int, codeGen &, bool) { assert(0); }
-    virtual void emitAddSignedImm(Address, int, codeGen &, bool) { assert(0); }
+    virtual bool emitAddSignedImm(Address, int, int, bool, codeGen &, bool) { assert(0); return false; }
     virtual int Register_DWARFtoMachineEnc(int) { assert(0); return 0;}
     virtual bool emitPush(codeGen &, Register) { assert(0); return true;}
     virtual bool emitPop(codeGen &, Register) { assert(0); return true;}
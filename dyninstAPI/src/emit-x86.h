@@ -128,7 +128,7 @@ public:
     void emitLoadEffectiveAddress(Register base, Register index, unsigned int scale, int disp,
 				  Register dest, codeGen &gen);
     void emitStoreImm(Address addr, int imm, codeGen &gen, bool noCost);
-    void emitAddSignedImm(Address addr, int imm, codeGen &gen, bool noCost);
+    bool emitAddSignedImm(Address addr, int imm, int size, bool atomic, codeGen &gen, bool noCost);
     int Register_DWARFtoMachineEnc(int n);
     bool emitPush(codeGen &gen, Register pushee);
     bool emitPop(codeGen &gen, Register popee);
@@ -244,7 +244,9 @@ public:
     bool emitBTSaves(baseTramp* bt, codeGen &gen);
     bool emitBTRestores(baseTramp* bt, codeGen &gen);
     void emitStoreImm(Address addr, int imm, codeGen &gen, bool noCost);
-    void emitAddSignedImm(Address addr, int imm, codeGen &gen, bool noCost);
+    bool emitAddSignedImm(Address addr, int imm, int size, bool atomic, codeGen &gen, bool noCost);
+    bool emitTLSGuard(bool acquire, long tls_offset, Register dest, codeGen &gen);
+    bool emitThreadIndex(long tls_offset, Address slow_path, Register dest, codeGen &gen);
     /* The DWARF register numbering does not correspond to the architecture's
        register encoding for 64-bit target binaries *only*. This method
        maps the number that DWARF reports for a register to the actual
@@ -102,7 +102,12 @@ class Emitter {
     virtual bool emitBTSaves(baseTramp* bt, codeGen &gen) = 0;
     virtual bool emitBTRestores(baseTramp* bt, codeGen &gen) = 0;
     virtual void emitStoreImm(Address addr, int imm, codeGen &gen, bool noCost) = 0;
-    virtual void emitAddSignedImm(Address addr, int imm, codeGen &gen, bool noCost) = 0;
+    // Returns false if the add could not be emitted as a single memory op
+    virtual bool emitAddSignedImm(Address addr, int imm, int size, bool atomic, codeGen &gen, bool noCost) = 0;
+    // Take (dest gets the old value) or release the thread-pointer-relative tramp guard
+    virtual bool emitTLSGuard(bool, long, Register, codeGen &) { return false; }
+    // Load the thread-pointer-relative thread index, calling slow_path the first time
+    virtual bool emitThreadIndex(long, Address, Register, codeGen &) { return false; }
     virtual bool emitPush(codeGen &, Register) = 0;
     virtual bool emitPop(codeGen &, Register) = 0;
     virtual bool emitAdjustStackPointer(int index, codeGen &gen) = 0;
@@ -37,6 +37,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
 #include <unordered_map>
 #include "common/src/Types.h"
 #include "common/h/util.h"
@@ -170,19 +172,50 @@ class inferiorHeap {
  public:
     void clear();
     
-  inferiorHeap() {
+  inferiorHeap() : freeBins(numSizeClasses) {
       freed = 0; disabledListTotalMem = 0; totalFreeMemAvailable = 0;
   }
   inferiorHeap(const inferiorHeap &src);  // create a new heap that is a copy
                                           // of src (used on fork)
   std::unordered_map<Address, heapItem*> heapActive; // active part of heap 
-  std::vector<heapItem*> heapFree;           // free block of data inferior heap 
+
+  // Free blocks are kept in an address-ordered map (for coalescing and
+  // successor/predecessor lookups) and are additionally binned by
+  // power-of-two size class. Each bin is address-ordered so that range
+  // constraints (lo/hi, e.g. from a "near" request) are a lower_bound
+  // away. Use the helpers below rather than touching these directly.
+  std::map<Address, heapItem*> heapFree;     // free block of data inferior heap 
+  std::vector<std::set<std::pair<Address, heapItem*> > > freeBins; // by size class
+
+  // Add a free block, coalescing it with adjacent free blocks of the
+  // same type. Returns the (possibly merged) block.
+  heapItem *addFree(heapItem *h);
+  // Remove a free block from the indices; does not delete it.
+  void removeFree(heapItem *h);
+  // Change the extent of a free block in place, keeping the indices
+  // current. A zero length removes and deletes the block.
+  void resizeFree(heapItem *h, Address addr, unsigned length);
+  // Segregated fit: find a free block of at least size bytes whose type
+  // matches the type mask and that fits within [lo, hi]. Counts the
+  // blocks examined in steps.
+  heapItem *findFree(unsigned size, int type, Address lo, Address hi,
+                     unsigned &steps) const;
+  // The free block starting (resp. ending) exactly at addr, if any
+  heapItem *freeStartingAt(Address addr) const;
+  heapItem *freeEndingAt(Address addr) const;
+
   std::vector<disabledItem> disabledList;    // items waiting to be freed.
   int disabledListTotalMem;             // total size of item waiting to free
   int totalFreeMemAvailable;            // total free memory in the heap
   int freed;                            // total reclaimed (over time)
 
   std::vector<heapItem *> bufferPool;        // distributed heap segments -- csserra
+
+ private:
+  static const unsigned numSizeClasses = 8 * sizeof(unsigned);
+  static unsigned sizeClass(unsigned length);
+  void binInsert(heapItem *h);
+  void binErase(heapItem *h);
 };
  
 #endif
@@ -265,9 +265,9 @@ bool writeFunctionPtr(AddressSpace *p, Address addr, func_instance *f);
  **/
 //Store constant in memory at address
 bool emitStoreConst(Address addr, int imm, codeGen &gen, bool noCost);
-//Add constant to memory at address
-bool emitAddSignedImm(Address addr, long int imm, codeGen &gen, bool noCost);
-//Subtract constant from memory at address
-bool emitSubSignedImm(Address addr, long int imm, codeGen &gen, bool noCost);
+//Add constant to the size-byte value in memory at address, atomically if requested
+bool emitAddSignedImm(Address addr, long int imm, int size, bool atomic, codeGen &gen, bool noCost);
+//Subtract constant from the size-byte value in memory at address
+bool emitSubSignedImm(Address addr, long int imm, int size, bool atomic, codeGen &gen, bool noCost);
 
 #endif
@@ -0,0 +1,147 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SELF_PROCESS_H
+#define SELF_PROCESS_H
+/*
+ * selfProcess.h
+ *
+ * An AddressSpace for the process Dyninst itself is running in. Objects are
+ * found through SymtabAPI's AddressLookup, memory is read and written
+ * directly, and instrumentation heaps come from the RT library's
+ * DYNINSTos_malloc, which is called as an ordinary function. Nothing here
+ * stops, traces, or signals the process.
+ */
+
+#include <string>
+
+#include "addressSpace.h"
+#include "infHeap.h"
+#include "dyninstAPI/h/BPatch_enums.h"
+
+namespace Dyninst {
+namespace SymtabAPI {
+class AddressLookup;
+}
+}
+
+class SelfProcess : public AddressSpace {
+ public:
+    // Create the address space for the calling process, loading and
+    // initializing the RT library if it is not already present
+    static SelfProcess *createSelf(BPatch_hybridMode analysisMode = BPatch_normalMode);
+
+    ~SelfProcess();
+
+    // Same usage pattern as process
+    void deleteSelfProcess();
+
+    // AddressSpace memory access; all of these are plain copies, with code
+    // pages made writable for the duration of a write
+    bool readDataSpace(const void *inOther,
+                       u_int amount,
+                       void *inSelf,
+                       bool showError);
+    bool readTextSpace(const void *inOther,
+                       u_int amount,
+                       void *inSelf);
+    bool writeDataSpace(void *inOther,
+                        u_int amount,
+                        const void *inSelf);
+    bool writeTextSpace(void *inOther,
+                        u_int amount,
+                        const void *inSelf);
+    bool readDataWord(const void *inOther,
+                      u_int amount,
+                      void *inSelf,
+                      bool showError);
+    bool readTextWord(const void *inOther,
+                      u_int amount,
+                      void *inSelf);
+    bool writeDataWord(void *inOther,
+                       u_int amount,
+                       const void *inSelf);
+    bool writeTextWord(void *inOther,
+                       u_int amount,
+                       const void *inSelf);
+
+    Address inferiorMalloc(unsigned size,
+                           inferiorHeapType type = anyHeap,
+                           Address near = 0,
+                           bool *err = NULL);
+    void inferiorFree(Address item);
+    bool inferiorRealloc(Address item, unsigned newSize);
+
+    /* AddressSpace pure virtual implementation */
+    unsigned getAddressWidth() const;
+    Address offset() const;
+    Address length() const;
+    Architecture getArch() const;
+
+    bool multithread_capable(bool ignore_if_mt_not_set = false);
+    bool multithread_ready(bool ignore_if_mt_not_set = false);
+
+    bool needsPIC();
+
+    virtual void addTrap(Address from, Address to, codeGen &gen);
+    virtual void removeTrap(Address /*from*/) {}
+
+    virtual bool getTrampGuardTPOffset(long &off);
+    virtual bool getThreadIndexTPOffset(long &off);
+
+    // dlopen a library into this process and create its mapped_object
+    mapped_object *loadLibrary(const std::string &path);
+
+    // Pick up objects loaded since the last call (e.g. by the
+    // application's own dlopen)
+    bool refreshObjects();
+
+ private:
+    SelfProcess(BPatch_hybridMode analysisMode);
+
+    bool bootstrap();
+    bool loadRTLib();
+    mapped_object *addObject(const std::string &path, Address base, bool isShared);
+    bool inferiorMallocDynamic(unsigned size, Address lo, Address hi);
+    void inferiorMallocConstraints(Address near, Address &lo, Address &hi);
+    bool getTPOffset(const char *var, long &off);
+
+    // Store into (possibly read-only) memory, atomically when the store
+    // fits in one aligned word.  Code is only written while no other
+    // thread is stopped partway through it.
+    bool writeSelf(Address addr, unsigned amount, const void *buf, bool isCode);
+
+    BPatch_hybridMode analysisMode_;
+    Dyninst::SymtabAPI::AddressLookup *lookup_;
+    void *rtHandle_;
+    void *(*rtMalloc_)(size_t, void *, void *);
+};
+
+#endif
@@ -32,10 +32,12 @@
 #define trapMappings_h_
 
 #define MIN_TRAP_TABLE_SIZE 256
+#define MIN_TRAP_HASH_SLOTS 64
 #define INDEX_INVALID UINT_MAX
 
 #include <vector>
 #include <set>
+#include <map>
 
 class AddressSpace;
 class int_variable;
@@ -65,11 +67,23 @@ class trampTrapMappings {
    const int_variable *trapTableVersion;
    const int_variable *trapTable;
    const int_variable *trapTableSorted;
+   const int_variable *trapHashTable;
 
    void writeToBuffer(unsigned char *buffer, unsigned long val, 
                       unsigned addr_width);
    void writeTrampVariable(const int_variable *var, unsigned long val);
 
+   // Dynamic-mode hash table mirrored in the mutatee; hash_sources
+   // shadows each slot's source so we can place entries without reading.
+   void updateHashTable(std::vector<tramp_mapping_t*> &changed);
+   void rebuildHashTable();
+   unsigned long hashSlotFor(Address from);
+   bool getTrapCountsMap(std::map<Address, unsigned long> &counts);
+   void writeHashEntry(unsigned long slot, Address from, Address to);
+   Address hash_table;
+   Address hash_table_prev;
+   std::vector<Address> hash_sources;
+
    unsigned long table_version;
    unsigned long table_used;
    unsigned long table_allocated;
@@ -90,6 +104,8 @@ class trampTrapMappings {
    void flush();
    void allocateTable();
    void shouldBlockFlushes(bool b) { blockFlushes = b; }
+   // Per-source trap transfer counts from the mutatee's hash table
+   bool getTrapCounts(std::vector<std::pair<Address, unsigned long> > &counts);
 
    bool empty();
 
@@ -0,0 +1,91 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#define NUM_CALLS 100
+#define NUM_WORDS 8
+#define SWEEP_WORDS 2048
+
+/* Layout of a BPatch_memoryTraceRecord */
+struct record {
+  unsigned long pc;
+  unsigned long address;
+  unsigned long size;
+};
+
+long flushed_records = 0;
+long sweep_flushed_records = 0;
+int words[NUM_WORDS];
+int sweep_words[SWEEP_WORDS];
+
+void trace_flush(const struct record *records, int count)
+{
+  (void) records;
+  flushed_records += count;
+}
+
+void sweep_flush(const struct record *records, int count)
+{
+  (void) records;
+  sweep_flushed_records += count;
+}
+
+/* Straight-line, so each traced access runs once per call */
+__attribute__((noinline)) void touch(int *p)
+{
+  p[0] = 0; p[1] = 1; p[2] = 2; p[3] = 3;
+  p[4] = p[0] + 4; p[5] = p[1] + 5; p[6] = p[2] + 6; p[7] = p[3] + 7;
+}
+
+/* Two adjacent stores per iteration, and many more iterations per call
+   than a trace buffer holds */
+__attribute__((noinline)) void sweep(int *p, int n)
+{
+  int i;
+  for (i = 0; i < n; i += 2) {
+    p[i] = i;
+    p[i + 1] = i;
+  }
+}
+
+__attribute__((noinline)) void done(void)
+{
+  __asm__ volatile("");
+}
+
+int main(void)
+{
+  int i;
+  for (i = 0; i < NUM_CALLS; i++) {
+    touch(words);
+    sweep(sweep_words, SWEEP_WORDS);
+  }
+  done();
+  return 0;
+}
@@ -150,6 +150,11 @@ typedef struct {
 
 #if !defined(DYNINST_SINGLETHREADED)
 #define DYNINST_SINGLETHREADED -128
+
+/* Thread indices whose owning LWP is recorded, and how many freed indices
+ * the mutator can hand back for reuse at once */
+#define DYNINST_THREAD_INDEX_LWPS 4096
+#define DYNINST_FREE_THREAD_INDICES 1024
 #endif
 #define DYNINST_TRACEPIPE_ERRVAL -1
 #define DYNINST_PRINTF_ERRVAL -2
@@ -163,6 +168,25 @@ typedef struct {
    void *target;
 } trapMapping_t;
 
+/* Open-addressing table of trap mappings published by the mutator for the
+   dynamic case.  A header is followed by mask+1 slots; an empty slot has a
+   NULL source.  The mutator fills slots in place while the load stays under
+   one half and otherwise builds a new table and swaps dyninstTrapHashTable
+   to it, so the handler never sees a partially built table. */
+typedef struct {
+   void *source;
+   void *target;
+   size_t hits;   /* trap transfers through this entry */
+} trapHashEntry_t;
+
+struct trap_hash_header {
+   uint64_t mask;
+   uint64_t num_entries;
+};
+
+#define DYNINST_TRAP_HASH(a) \
+   ((uint32_t) ((((uint64_t) (a)) ^ (((uint64_t) (a)) >> 29)) * 0x9E3779B97F4A7C15ULL >> 32))
+
 #define TRAP_HEADER_SIG 0x759191D6
 #define DT_DYNINST 0x6D191957
 
@@ -235,6 +259,40 @@ struct MemoryMapper64 {
 
 DLLEXPORT extern struct MemoryMapper RTmemoryMapper;
 
+/* Shared-memory trace buffers.  The mutator creates and maps the region and
+ * has the RT map the same pages; ring N is appended to only by the thread
+ * with index N, and the mutator drains the rings in place.  head and tail
+ * are slot numbers below slots, and one slot is always left empty so a full
+ * ring can be told from an empty one.  Everything here is fixed width so
+ * 32-bit mutatees share the layout. */
+
+#define DYNINST_TRACE_MAGIC 0x54524143
+#define DYNINST_TRACE_LINE 64
+#define DYNINST_TRACE_MAX_BUFFERS 8
+#define DYNINST_TRACE_MAX_WORDS 4
+
+struct DYNINST_traceHeader {
+   uint32_t magic;
+   uint32_t record_words;   /* 64-bit words per record */
+   uint32_t slots;          /* record slots per ring */
+   uint32_t num_rings;
+   uint32_t unserved;       /* records from threads without a ring */
+   uint32_t padding;
+   uint64_t ring_bytes;     /* stride between rings */
+   uint8_t pad[DYNINST_TRACE_LINE - 32];
+};
+
+struct DYNINST_traceRing {
+   /* Written only by the producing thread */
+   volatile uint32_t head;
+   uint32_t dropped;
+   uint8_t pad0[DYNINST_TRACE_LINE - 8];
+   /* Written only by the mutator */
+   volatile uint32_t tail;
+   uint8_t pad1[DYNINST_TRACE_LINE - 4];
+   uint64_t records[]; /* slots * record_words */
+};
+
 extern int RTuntranslatedEntryCounter;
 
 #include "dyninstRTExport.h"
@@ -62,6 +62,16 @@ DLLEXPORT int DYNINSTuserMessage(void *msg, unsigned int msg_size);
    may differ at certain times from the number of threads actually present.) */
 DLLEXPORT int DYNINSTthreadCount();
 
+/* Returns the calling thread's index, a dense 0..n labelling of threads
+   assigned the first time each thread asks. */
+DLLEXPORT int DYNINSTthreadIndex();
+
+/* Append one record to the calling thread's ring in trace buffer <id>
+   (see BPatch_process::createTraceBuffer).  Words beyond the buffer's
+   record size are ignored; a full ring drops the record. */
+DLLEXPORT void DYNINSTtraceAppend(int id, unsigned long w0, unsigned long w1,
+                                  unsigned long w2, unsigned long w3);
+
 /**
  * These function implement a locking mechanism that can be used by 
  * a user's runtime library.
@@ -107,6 +117,7 @@ DLLEXPORT unsigned long RTtranslateMemory(unsigned long, unsigned long, unsigned
 DLLEXPORT unsigned long RTtranslateMemoryShift(unsigned long, unsigned long, unsigned long);
 DLLEXPORT void *DYNINSTos_malloc(size_t, void *, void *); 
 DLLEXPORT int DYNINSTloadLibrary(char *);
+DLLEXPORT void *DYNINSTtraceMap(int, const char *, unsigned long);
 
 /** 
  * And variables
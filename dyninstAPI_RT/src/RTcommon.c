@@ -113,23 +113,6 @@ DLLEXPORT void *DYNINST_target_cache[TARGET_CACHE_WIDTH][TARGET_CACHE_WAYS];
 FILE *stOut;
 int fakeTickCount;
 
-
-#ifdef _MSC_VER
-#define TLS_VAR __declspec(thread)
-#else
-// Note, the initial-exec model gives us static TLS which can be accessed
-// directly, unlike dynamic TLS that calls __tls_get_addr().  Such calls risk
-// recursing back to us if they're also instrumented, ad infinitum.  Static TLS
-// must be used very sparingly though, because it is a limited resource.
-// *** This case is very special -- do not use IE in general libraries! ***
-
-#if defined(DYNINST_RT_STATIC_LIB)
-#define TLS_VAR __thread __attribute__ ((tls_model("local-exec")))
-#else
-#define TLS_VAR __thread __attribute__ ((tls_model("initial-exec")))
-#endif
-#endif
-
 // It's tempting to make this a char, but glibc < 2.17 hits a bug:
 //   https://sourceware.org/bugzilla/show_bug.cgi?id=14898
 static TLS_VAR short DYNINST_tls_tramp_guard = 1;
@@ -145,6 +128,28 @@ DLLEXPORT void DYNINST_unlock_tramp_guard()
   DYNINST_tls_tramp_guard = 1;
 }
 
+// Offsets of DYNINST_tls_tramp_guard and DYNINST_tls_thread_index from the
+// thread pointer, so the mutator can access them inline.  Static TLS sits at
+// the same offset in every thread; zero means unknown and the mutator falls
+// back to calling the functions.
+DLLEXPORT long DYNINST_tramp_guard_tpoff = 0;
+DLLEXPORT long DYNINST_thread_index_tpoff = 0;
+
+static void initTLSOffsets()
+{
+#if defined(__x86_64__) && defined(__linux__) && !defined(_MSC_VER)
+   char *tp;
+   __asm__ ("mov %%fs:0, %0" : "=r" (tp));
+   DYNINST_tramp_guard_tpoff = (char *) &DYNINST_tls_tramp_guard - tp;
+   DYNINST_thread_index_tpoff = (char *) &DYNINST_tls_thread_index - tp;
+#elif defined(__aarch64__) && defined(__linux__)
+   char *tp;
+   __asm__ ("mrs %0, tpidr_el0" : "=r" (tp));
+   DYNINST_tramp_guard_tpoff = (char *) &DYNINST_tls_tramp_guard - tp;
+   DYNINST_thread_index_tpoff = (char *) &DYNINST_tls_thread_index - tp;
+#endif
+}
+
 DECLARE_DYNINST_LOCK(DYNINST_trace_lock);
 
 /**
@@ -170,6 +175,8 @@ void DYNINSTBaseInit()
    DYNINSTinitializeTrapHandler();
 #endif
    DYNINST_unlock_tramp_guard();
+   initTLSOffsets();
+   DYNINSTthreadIndex();
    DYNINSThasInitialized = 1;
 
    RTuntranslatedEntryCounter = 0;
@@ -684,6 +691,38 @@ DLLEXPORT volatile unsigned long dyninstTrapTableVersion;
 DLLEXPORT volatile trapMapping_t *dyninstTrapTable;
 DLLEXPORT volatile unsigned long dyninstTrapTableIsSorted;
 
+DLLEXPORT volatile struct trap_hash_header *dyninstTrapHashTable;
+DLLEXPORT volatile unsigned long dyninstTrapCount;
+
+/* O(1) probe of the mutator's hash table.  The counters are plain
+   increments; a lost update under contention only skews the statistics. */
+void *dyninstTrapHashTranslate(void *source)
+{
+   volatile struct trap_hash_header *table;
+   volatile trapHashEntry_t *slots;
+   unsigned long mask, i, n;
+   void *cur;
+
+   dyninstTrapCount++;
+   table = dyninstTrapHashTable;
+   if (!table)
+      return NULL;
+
+   mask = (unsigned long) table->mask;
+   slots = (volatile trapHashEntry_t *) (table + 1);
+   i = DYNINST_TRAP_HASH(source) & mask;
+   for (n = 0; n <= mask; n++, i = (i + 1) & mask) {
+      cur = slots[i].source;
+      if (cur == source) {
+         slots[i].hits++;
+         return slots[i].target;
+      }
+      if (!cur)
+         break;
+   }
+   return NULL;
+}
+
 void* dyninstTrapTranslate(void *source,
                            volatile unsigned long *table_used,
                            volatile unsigned long *table_version,
@@ -35,6 +35,22 @@
 #include "RTthread.h"
 #include <stdarg.h>
 
+#ifdef _MSC_VER
+#define TLS_VAR __declspec(thread)
+#else
+// Note, the initial-exec model gives us static TLS which can be accessed
+// directly, unlike dynamic TLS that calls __tls_get_addr().  Such calls risk
+// recursing back to us if they're also instrumented, ad infinitum.  Static TLS
+// must be used very sparingly though, because it is a limited resource.
+// *** This case is very special -- do not use IE in general libraries! ***
+
+#if defined(DYNINST_RT_STATIC_LIB)
+#define TLS_VAR __thread __attribute__ ((tls_model("local-exec")))
+#else
+#define TLS_VAR __thread __attribute__ ((tls_model("initial-exec")))
+#endif
+#endif
+
 void DYNINSTtrapFunction();
 void DYNINSTbreakPoint();
 /* Use a signal that is safe if we're not attached. */
@@ -45,6 +61,7 @@ int DYNINSTwriteEvent(void *ev, size_t sz);
 int DYNINSTasyncConnect(int pid);
 
 int DYNINSTinitializeTrapHandler();
+void *dyninstTrapHashTranslate(void *source);
 void* dyninstTrapTranslate(void *source, 
                            volatile unsigned long *table_used,
                            volatile unsigned long *table_version,
@@ -58,6 +75,7 @@ extern int libdyninstAPI_RT_init_maxthreads;
 extern int libdyninstAPI_RT_init_debug_flag;
 extern int DYNINSTdebugPrintRT;
 extern tc_lock_t DYNINST_trace_lock;
+extern TLS_VAR int DYNINST_tls_thread_index;
 
 extern void *map_region(void *addr, int len, int fd);
 extern int unmap_region(void *addr, int len);
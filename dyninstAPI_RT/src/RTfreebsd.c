@@ -309,26 +309,30 @@ void dyninstTrapHandler(int sig, siginfo_t *sg, ucontext_t *context)
    assert(orig_ip);
 
    // Find the new IP we're going to and substitute. Leave everything else untouched
+   trap_to = NULL;
    if (DYNINSTstaticMode) {
       unsigned long zero = 0;
       unsigned long one = 1;
       struct trap_mapping_header *hdr = getStaticTrapMap((unsigned long) orig_ip);
-      if (!hdr) return;
-
-      assert(hdr);
-      trapMapping_t *mapping = &(hdr->traps[0]);
-      trap_to = dyninstTrapTranslate(orig_ip, 
-                                     (unsigned long *) &hdr->num_entries, 
-                                     &zero, 
-                                     (volatile trapMapping_t **) &mapping,
-                                     &one);
+      if (hdr) {
+         trapMapping_t *mapping = &(hdr->traps[0]);
+         trap_to = dyninstTrapTranslate(orig_ip, 
+                                        (unsigned long *) &hdr->num_entries, 
+                                        &zero, 
+                                        (volatile trapMapping_t **) &mapping,
+                                        &one);
+      }
    }
-   else {
-      trap_to = dyninstTrapTranslate(orig_ip, 
-                                     &dyninstTrapTableUsed,
-                                     &dyninstTrapTableVersion,
-                                     (volatile trapMapping_t **) &dyninstTrapTable,
-                                     &dyninstTrapTableIsSorted);
+   /* No rewritten object covers this trap; it was installed at runtime,
+      either by a mutator or by the process instrumenting itself */
+   if (!trap_to) {
+      trap_to = dyninstTrapHashTranslate(orig_ip);
+      if (!trap_to)
+         trap_to = dyninstTrapTranslate(orig_ip, 
+                                        &dyninstTrapTableUsed,
+                                        &dyninstTrapTableVersion,
+                                        (volatile trapMapping_t **) &dyninstTrapTable,
+                                        &dyninstTrapTableIsSorted);
                                      
    }
    UC_PC(context) = (long) trap_to;
@@ -32,6 +32,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#if defined(os_linux)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "RTthread.h"
 #include "RTcommon.h"
@@ -48,5 +52,71 @@ void setNewthrCB(void (*cb)(int)) {
 
 #define IDX_NONE -1
 
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
+/* Dense 0..n index for each thread, handed out on the thread's first call
+   and kept in static TLS so the mutator can load it inline; see
+   DYNINST_thread_index_tpoff. */
+TLS_VAR int DYNINST_tls_thread_index = IDX_NONE;
+static volatile long DYNINST_thread_index_next = 0;
+
+/* The LWP each index was handed to, so the mutator can tell which index an
+   exiting thread held.  The mutator returns those indices through the free
+   list; threads pop from it before minting a new index.  Pops hold
+   DYNINST_free_thread_index_lock.  The mutator writes the list only while
+   the process is stopped and the lock is free, so it never sees a thread
+   partway through a pop. */
+DLLEXPORT volatile int DYNINST_thread_index_lwps[DYNINST_THREAD_INDEX_LWPS];
+DLLEXPORT volatile int DYNINST_free_thread_indices[DYNINST_FREE_THREAD_INDICES];
+DLLEXPORT volatile int DYNINST_free_thread_index_count = 0;
+DLLEXPORT DECLARE_DYNINST_LOCK(DYNINST_free_thread_index_lock);
+
+static int popFreeThreadIndex()
+{
+#if defined(_MSC_VER)
+   return IDX_NONE;
+#else
+   int idx = IDX_NONE;
+   if (tc_lock_lock(&DYNINST_free_thread_index_lock) == DYNINST_DEAD_LOCK)
+      return IDX_NONE;
+   if (DYNINST_free_thread_index_count > 0) {
+      DYNINST_free_thread_index_count--;
+      idx = DYNINST_free_thread_indices[DYNINST_free_thread_index_count];
+   }
+   tc_lock_unlock(&DYNINST_free_thread_index_lock);
+   return idx;
+#endif
+}
+
+DLLEXPORT int DYNINSTthreadIndex()
+{
+   long idx;
+
+   if (DYNINST_tls_thread_index != IDX_NONE)
+      return DYNINST_tls_thread_index;
+
+   idx = popFreeThreadIndex();
+   if (idx == IDX_NONE) {
+#if defined(_MSC_VER)
+      idx = InterlockedIncrement(&DYNINST_thread_index_next) - 1;
+#else
+      idx = __sync_fetch_and_add(&DYNINST_thread_index_next, 1);
+#endif
+   }
+#if defined(os_linux)
+   if (idx < DYNINST_THREAD_INDEX_LWPS)
+      DYNINST_thread_index_lwps[idx] = (int) syscall(SYS_gettid);
+#endif
+   DYNINST_tls_thread_index = (int) idx;
+   return DYNINST_tls_thread_index;
+}
+
+DLLEXPORT int DYNINSTthreadCount()
+{
+   return (int) DYNINST_thread_index_next;
+}
+
 
 
@@ -0,0 +1,155 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/************************************************************************
+ * RTtrace.c: per-thread shared-memory trace rings
+ *
+ * The mutator creates a trace region, fills in its header, and has us map
+ * the same file via DYNINSTtraceMap.  Ring N belongs to the thread with
+ * index N, so the mutator's inline append and DYNINSTtraceAppend below
+ * agree on where a thread's records go without any per-thread state here.
+ * A thread's ring is reused along with its index once the thread exits.
+ * The mutator drains rings in place.
+ ************************************************************************/
+
+#include "dyninstAPI_RT/h/dyninstAPI_RT.h"
+#include "dyninstAPI_RT/src/RTcommon.h"
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(DYNINST_RT_STATIC_LIB)
+/* As with pthread_self in RTlinux.c, don't make the static library depend
+   on pthread_atfork. */
+#pragma weak pthread_atfork
+extern int pthread_atfork(void (*)(void), void (*)(void), void (*)(void));
+#else
+#include <pthread.h>
+#endif
+
+static struct DYNINST_traceHeader *volatile trace_buffers[DYNINST_TRACE_MAX_BUFFERS];
+static unsigned long trace_sizes[DYNINST_TRACE_MAX_BUFFERS];
+
+/* A forked child keeps the shared mapping, and its thread carries the
+   forking thread's index, so it would append to a ring whose producer is
+   still running in the parent.  Put private zeroed pages in its place: the
+   child's appends land there, and the header's zero ring count turns the
+   rest away. */
+static void traceForkChild(void)
+{
+   int i;
+   for (i = 0; i < DYNINST_TRACE_MAX_BUFFERS; i++) {
+      if (!trace_buffers[i])
+         continue;
+      mmap((void *) trace_buffers[i], trace_sizes[i], PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+   }
+}
+
+DLLEXPORT void *DYNINSTtraceMap(int id, const char *path, unsigned long size)
+{
+   static int registered_fork_handler = 0;
+   int fd;
+   void *base;
+
+   if (id < 0 || id >= DYNINST_TRACE_MAX_BUFFERS || trace_buffers[id])
+      return NULL;
+
+   fd = open(path, O_RDWR);
+   if (fd == -1) {
+      rtdebug_printf("%s[%d]:  failed to open trace buffer %s\n", __FILE__, __LINE__, path);
+      return NULL;
+   }
+   base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (base == MAP_FAILED)
+      return NULL;
+
+   if (((struct DYNINST_traceHeader *) base)->magic != DYNINST_TRACE_MAGIC) {
+      munmap(base, size);
+      return NULL;
+   }
+
+   if (!registered_fork_handler) {
+#if defined(DYNINST_RT_STATIC_LIB)
+      if (pthread_atfork)
+#endif
+         pthread_atfork(NULL, NULL, traceForkChild);
+      registered_fork_handler = 1;
+   }
+
+   trace_sizes[id] = size;
+   __atomic_store_n(&trace_buffers[id], (struct DYNINST_traceHeader *) base,
+                    __ATOMIC_RELEASE);
+   return base;
+}
+
+DLLEXPORT void DYNINSTtraceAppend(int id, unsigned long w0, unsigned long w1,
+                                  unsigned long w2, unsigned long w3)
+{
+   struct DYNINST_traceHeader *hdr;
+   struct DYNINST_traceRing *ring;
+   uint64_t *rec;
+   uint32_t head, next;
+   int index;
+
+   if (id < 0 || id >= DYNINST_TRACE_MAX_BUFFERS)
+      return;
+   hdr = __atomic_load_n(&trace_buffers[id], __ATOMIC_ACQUIRE);
+   if (!hdr)
+      return;
+
+   index = DYNINSTthreadIndex();
+   if (index < 0 || (uint32_t) index >= hdr->num_rings) {
+      __atomic_fetch_add(&hdr->unserved, 1, __ATOMIC_RELAXED);
+      return;
+   }
+   ring = (struct DYNINST_traceRing *)
+      ((char *) hdr + DYNINST_TRACE_LINE + (size_t) index * hdr->ring_bytes);
+
+   head = ring->head;
+   next = head + 1;
+   if (next == hdr->slots)
+      next = 0;
+   if (next == __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) {
+      ring->dropped++;
+      return;
+   }
+
+   rec = ring->records + (size_t) head * hdr->record_words;
+   switch (hdr->record_words) {
+      case 4: rec[3] = w3; /* fall through */
+      case 3: rec[2] = w2; /* fall through */
+      case 2: rec[1] = w1; /* fall through */
+      case 1: rec[0] = w0;
+   }
+   __atomic_store_n(&ring->head, next, __ATOMIC_RELEASE);
+}
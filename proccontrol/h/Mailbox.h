@@ -30,6 +30,7 @@
 #if !defined(MAILBOX_H_)
 #define MAILBOX_H_
 
+#include <vector>
 #include "Event.h"
 #include "util.h"
 
@@ -56,6 +57,10 @@ public:
 	// These should *only* be used internally to proccontrol...
    virtual void lock_queue() = 0;
    virtual void unlock_queue() = 0;
+
+   // Queue several events with a single wakeup.  The default just
+   // enqueues them one at a time.
+   virtual void enqueue_batch(const std::vector<Event::ptr> &evs);
 };
 
 extern PC_EXPORT Mailbox* mbox();
@@ -131,6 +131,9 @@ class PC_EXPORT Breakpoint
    static Breakpoint::ptr newTransferBreakpoint(Dyninst::Address to);
    static Breakpoint::ptr newTransferOffsetBreakpoint(signed long shift);
    static Breakpoint::ptr newHardwareBreakpoint(unsigned int mode, unsigned int size);
+   //Counting breakpoints never deliver callbacks; hits are tallied by
+   // ProcControlAPI and the thread is resumed without stopping the process.
+   static Breakpoint::ptr newCountingBreakpoint();
 
    void *getData() const;
    void setData(void *p) const;
@@ -140,6 +143,10 @@ class PC_EXPORT Breakpoint
 
    void setSuppressCallbacks(bool);
    bool suppressCallbacks() const;
+
+   bool isCounting() const;
+   unsigned long getHitCount() const;
+   void resetHitCount();
 };
 
 class PC_EXPORT Library
@@ -273,6 +280,10 @@ class PC_EXPORT IRPC
    unsigned long getStartOffset() const;
    bool isBlocking() const;
 
+   // For iRPCs posted with postIRPCShared, the number from the same post
+   // that have not yet finished.  Zero for any other iRPC.
+   unsigned long numPendingInGroup() const;
+
    // user-defined data retrievable during a callback
    void *getData() const;
    void setData(void *p) const;
@@ -612,6 +623,10 @@ class PC_EXPORT Thread : public boost::enable_shared_from_this<Thread>
    bool setAllRegisters(RegisterPool &pool) const;
    bool getAllRegistersAsync(RegisterPool &pool, void *opaque_val = NULL) const;
    bool setAllRegistersAsync(RegisterPool &pool, void *opaque_val = NULL) const;
+   // Register reads served from or missed by the per-stop register cache, and
+   // writes held back until the thread resumed, over the thread's lifetime.
+   bool getRegisterCacheStats(unsigned long &hits, unsigned long &misses,
+                              unsigned long &deferred_writes) const;
 
    bool readThreadLocalMemory(void *buffer, Library::const_ptr lib, Dyninst::Offset tls_symbol_offset, size_t size) const;
    bool writeThreadLocalMemory(Library::const_ptr lib, Dyninst::Offset tls_symbol_offset, const void *buffer, size_t size) const;
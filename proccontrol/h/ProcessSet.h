@@ -384,6 +384,15 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
    bool postIRPC(IRPC::ptr irpc, std::multimap<Process::ptr, IRPC::ptr> *result = NULL) const;
    bool postIRPC(IRPC::ptr irpc, AddressSet::ptr addrs, std::multimap<Process::ptr, IRPC::ptr> *result = NULL) const;
 
+   /**
+    * Post a copy of irpc to each process, with the code allocated and written
+    * for every process in one batch.  The code buffers are added to code_addrs,
+    * if given, and may be freed with freeMemory once numPendingInGroup() on the
+    * returned IRPCs reaches zero.
+    **/
+   bool postIRPCShared(IRPC::ptr irpc, std::multimap<Process::ptr, IRPC::ptr> *result = NULL,
+                       AddressSet::ptr code_addrs = AddressSet::ptr()) const;
+
    /**
     * Perform specific operations.  Interface objects will only be returned
     * on appropriately supported platforms, others will return NULL.
@@ -551,6 +560,15 @@ class PC_EXPORT ThreadSet : public boost::enable_shared_from_this<ThreadSet> {
    bool postIRPC(const std::multimap<Thread::const_ptr, IRPC::ptr> &rpcs) const;
    bool postIRPC(IRPC::ptr irpc, std::multimap<Thread::ptr, IRPC::ptr> *result = NULL) const;
 
+   /**
+    * Post a copy of irpc to each thread.  The code is allocated and written
+    * once per process and shared by all of that process's threads, which only
+    * need their registers set up.  See ProcessSet::postIRPCShared for
+    * code_addrs and tracking completion.
+    **/
+   bool postIRPCShared(IRPC::ptr irpc, std::multimap<Thread::ptr, IRPC::ptr> *result = NULL,
+                       AddressSet::ptr code_addrs = AddressSet::ptr()) const;
+
    /**
     * Perform specific operations.  Interface objects will only be returned
     * on appropriately supported platforms, others will return NULL.
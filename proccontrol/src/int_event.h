@@ -70,6 +70,7 @@ class int_eventBreakpointClear
    bool cached_bp_sets;
    bool set_singlestep;
    bool stopped_proc;
+   result_response::ptr pc_regset;
 
    std::set<Thread::ptr> clearing_threads;
 };
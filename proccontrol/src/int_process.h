@@ -50,6 +50,7 @@
 #include <utility>
 #include <queue>
 #include <stack>
+#include <atomic>
 
 namespace Dyninst {
 namespace ProcControlAPI {
@@ -104,6 +105,12 @@ struct bp_install_state {
    result_response::ptr res_resp;
 };
 
+//Longest instruction we'll relocate for a displaced step, and the space
+// reserved for its relocated copy plus the jump back.
+#define DISPLACED_INSN_MAX 16
+#define DISPLACED_SLOT_SIZE 32
+#define DISPLACED_POOL_SIZE 4096
+
 /**
  * Data reflecting the contents of a process's memory should be
  * stored in the mem_state object (e.g, breakpoints, libraries
@@ -128,7 +135,21 @@ class mem_state
    std::set<int_process *> procs;
    std::set<int_library *> libs;
    std::map<Dyninst::Address, sw_breakpoint *> breakpoints;
+   //Held while breakpoint bytes are written, whenever breakpoints or an
+   // sw_breakpoint's set of int_breakpoints changes, and by the generator
+   // while it steps over a counting breakpoint.
+   Mutex<true> bp_lock;
    std::map<Dyninst::Address, unsigned long> inf_malloced_memory;
+
+   struct displaced_step {
+      Dyninst::Address slot;
+      unsigned orig_size;
+      unsigned char orig[DISPLACED_INSN_MAX];
+   };
+   std::map<Dyninst::Address, displaced_step> displaced_steps;
+   std::vector<Dyninst::Address> displaced_free;
+   Dyninst::Address displaced_pool;
+   unsigned long displaced_pool_used;
 };
 
 /**
@@ -274,6 +295,7 @@ class int_process
    bool attachThreads(bool &found_new_threads);
    bool attachThreads();
    virtual bool plat_attachThreadsSync();
+   virtual bool plat_attachNewThreads(bool &found_new_threads);
 
    virtual async_ret_t post_attach(bool wasDetached, std::set<response::ptr> &aresps);
    async_ret_t initializeAddressSpace(std::set<response::ptr> &async_responses);
@@ -501,6 +523,25 @@ class int_process
    virtual async_ret_t plat_needsEmulatedSingleStep(int_thread *thr, std::vector<Dyninst::Address> &result);
    virtual bool plat_convertToBreakpointAddress(Address &, int_thread *) { return true; }
    virtual void plat_getEmulatedSingleStepAsyncs(int_thread *thr, std::set<response::ptr> resps);
+
+   //Displaced stepping resumes a thread past a breakpoint by running a
+   // relocated copy of the original instruction, so the breakpoint never
+   // leaves memory and the other threads need not stop.
+   static bool useDisplacedStepping();
+   virtual bool plat_supportDisplacedStep() const { return false; }
+   virtual bool plat_createDisplacedStep(Dyninst::Address from, const unsigned char *orig,
+                                         unsigned orig_size, Dyninst::Address to,
+                                         unsigned char *buffer, unsigned &buffer_size,
+                                         unsigned &insn_size);
+   bool prepDisplacedStep(Dyninst::Address addr);
+   Dyninst::Address getDisplacedStep(Dyninst::Address addr) const;
+   //The displaced copy thr resumes through when continued off bp, or 0 if
+   // it has to step over bp in place
+   Dyninst::Address displacedStepForClear(int_thread *thr, bp_instance *bp) const;
+   void releaseDisplacedStep(Dyninst::Address addr);
+ private:
+   bool displacedSlotInUse(Dyninst::Address slot);
+ public:
    virtual bool plat_needsThreadForMemOps() const { return true; }
    virtual unsigned int plat_getCapabilities();
    virtual Event::ptr plat_throwEventsBeforeContinue(int_thread *thr);
@@ -963,6 +1004,7 @@ public:
    void setRunningRPC(int_iRPC_ptr rpc_);
    void clearRunningRPC();
    int_iRPC_ptr runningRPC() const;
+   void leaveRPCGroups();
    bool saveRegsForRPC(allreg_response::ptr response);
    bool restoreRegsForRPC(bool clear, result_response::ptr response);
    bool hasSavedRPCRegs();
@@ -1002,6 +1044,11 @@ public:
    void updateRegCache(int_registerPool &pool);
    void updateRegCache(Dyninst::MachRegister reg, Dyninst::MachRegisterVal val);
    void clearRegCache();
+   bool fillRegCache();
+   bool flushRegCache();
+   void getRegCacheStats(unsigned long &hits, unsigned long &misses,
+                         unsigned long &deferred) const;
+   static bool batchRegisterAccess();
 
    // The exiting property is separate from the main state because an
    // exiting thread can either be running or stopped (depending on the
@@ -1108,6 +1155,10 @@ public:
 
    int_registerPool cached_regpool;
    Mutex<true> regpool_lock;
+   std::set<Dyninst::MachRegister> dirty_regs;
+   unsigned long regcache_hits;
+   unsigned long regcache_misses;
+   unsigned long regcache_deferred;
    int_iRPC_ptr running_rpc;
    int_iRPC_ptr writing_rpc;
    rpc_list_t posted_rpcs;
@@ -1308,6 +1359,8 @@ class int_breakpoint
    bool procstopper;
    bool suppress_callbacks;
    bool offset_transfer;
+   bool counting;
+   std::atomic<unsigned long> hit_count;
    std::set<Thread::const_ptr> thread_specific;
  public:
    int_breakpoint(Breakpoint::ptr up);
@@ -1341,6 +1394,13 @@ class int_breakpoint
 
    bool isOffsetTransfer() const;
    Breakpoint::weak_ptr upBreakpoint() const;
+
+   //Counting breakpoints only record hits; see sw_breakpoint::isCountingOnly
+   void setCounting(bool b);
+   bool isCounting() const;
+   void noteHit();
+   unsigned long getHitCount() const;
+   void resetHitCount();
 };
 
 class bp_instance
@@ -1423,12 +1483,22 @@ class sw_breakpoint : public bp_instance
    bool insertBreakpoint(int_process *proc, result_response::ptr res_resp);
    bool addToIntBreakpoint(int_breakpoint *bp, int_process *proc);
 
+   virtual bool rmBreakpoint(int_process *proc, int_breakpoint *bp,
+                             bool &empty, std::set<response::ptr> &resps);
    virtual async_ret_t uninstall(int_process *proc, std::set<response::ptr> &resps);
    virtual async_ret_t suspend(int_process *proc, std::set<response::ptr> &resps);
    virtual async_ret_t resume(int_process *proc, std::set<response::ptr> &resps);
 
    unsigned getNumIntBreakpoints() const;
    virtual bool needsClear();
+
+   //True if every breakpoint here only counts hits, meaning a hit can be
+   // stepped over by the generator without ever queuing an event.
+   bool isCountingOnly() const;
+   void noteCountingHits();
+   //Synchronous writes used while stepping a thread over this breakpoint
+   bool writeOrigDataSync(int_process *proc, int_thread *thr);
+   bool writeTrapSync(int_process *proc, int_thread *thr);
 };
 
 class hw_breakpoint : public bp_instance {
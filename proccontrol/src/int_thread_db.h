@@ -67,6 +67,31 @@ using namespace ProcControlAPI;
 
 class thread_db_thread;
 
+/**
+ * Where the struct pthread fields we care about live in the target, as
+ * described by the _thread_db_* descriptors glibc exports for libthread_db.
+ * Each descriptor is {size in bits, element count, offset}.  When the
+ * descriptors are present we can build thread handles and thread info
+ * ourselves rather than going through libthread_db for every thread.
+ **/
+struct tdb_pthread_layout {
+   typedef enum {
+      unprobed,
+      known,
+      unknown
+   } state_t;
+   state_t state;
+   uint32_t size;
+   uint32_t tid[3];
+   uint32_t start_routine[3];
+   uint32_t specific[3];
+   uint32_t report_events[3];
+   uint32_t span_start;
+   uint32_t span_end;
+
+   tdb_pthread_layout();
+};
+
 class thread_db_process : public int_threadTracking
 {
    friend class thread_db_thread;
@@ -196,6 +221,12 @@ private:
     std::set<int_library *> libs_with_cached_tls_areas;
 
     async_ret_t ll_fetchThreadInfo(td_thrhandle_t *th, td_thrinfo_t *info);
+
+    tdb_pthread_layout layout;
+    bool lookupLayoutSymbol(const char *name, Dyninst::Address &addr);
+    async_ret_t probePthreadLayout();
+    async_ret_t fastFetchThreadInfo(td_thrhandle_t *th, td_thrinfo_t *info);
+    async_ret_t fastMapLWP(thread_db_thread *thr);
 };
 
 /*
@@ -91,6 +91,17 @@ class iRPCAllocation
    boost::weak_ptr<int_iRPC> deletion_irpc;
 };
 
+//Shared by the iRPCs posted together by postIRPCShared, counting how many
+// of them have yet to finish.
+class iRPCGroup
+{
+  public:
+   typedef boost::shared_ptr<iRPCGroup> ptr;
+   iRPCGroup() : pending(0) {}
+
+   unsigned long pending;
+};
+
 class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
 {
    friend void boost::checked_delete<int_iRPC>(int_iRPC *) CHECKED_DELETE_NOEXCEPT;   
@@ -184,6 +195,16 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setDirectFree(bool s) { directFree_ = s; }
    bool directFree() const { return directFree_; }
 
+   //Shared-code iRPCs run from a buffer written once for the whole group,
+   // so they neither write their code nor save what was under it.
+   void setSharedCode(bool b) { shared_code = b; }
+   bool sharedCode() const { return shared_code; }
+   void setGroup(iRPCGroup::ptr g);
+   iRPCGroup::ptr getGroup() const { return group; }
+   //Stop counting this iRPC as pending in its group, for when it will
+   // never finish because its thread or process is going away.
+   void leaveGroup();
+
    void getPendingResponses(std::set<response::ptr> &resps);
    void syncAsyncResponses(bool is_sync);
 
@@ -222,6 +243,9 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    result_response::ptr rpcwrite_result;
    result_response::ptr pcset_result;
    bool directFree_;
+   bool shared_code;
+   iRPCGroup::ptr group;
+   bool left_group;
    void *user_data;
 };
 
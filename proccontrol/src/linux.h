@@ -59,6 +59,18 @@ class GeneratorLinux : public GeneratorMT
   private:
    int generator_lwp;
    int generator_pid;
+   //Most waitpid results collected into one generator batch
+   static const unsigned max_event_batch = 256;
+   //Children created only to knock the generator out of waitpid.
+   // wake_cond guards them, in_waitpid, which is set while the generator
+   // is blocked in waitpid, and waitpid_exits, which counts its returns.
+   std::set<int> wake_pids;
+   CondVar<> wake_cond;
+   bool in_waitpid;
+   unsigned long waitpid_exits;
+   bool wakeWithChild();
+   bool isWakePid(int pid);
+   void setInWaitpid(bool b);
 
   public:
    GeneratorLinux();
@@ -67,6 +79,7 @@ class GeneratorLinux : public GeneratorMT
    virtual bool initialize();
    virtual bool canFastHandle();
    virtual ArchEvent *getEvent(bool block);
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
    void evictFromWaitpid();
 };
 
@@ -112,6 +125,7 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool plat_create_int();
    virtual bool plat_attach(bool allStopped, bool &);
    virtual bool plat_attachThreadsSync();
+   virtual bool plat_attachNewThreads(bool &found_new_threads);
    virtual bool plat_attachWillTriggerStop();
    virtual bool plat_forked();
    virtual bool plat_execed();
@@ -148,6 +162,12 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool plat_lwpChangeTracking(bool b);
    virtual bool allowSignal(int signal_no);
 
+   // Processes attached with PTRACE_SEIZE (see useSeize) have their threads
+   // stopped with PTRACE_INTERRUPT rather than SIGSTOP.  Threads and
+   // children auto-attached from a seized process are seized as well.
+   static bool useSeize();
+   bool isSeized() const { return seized; }
+
    bool readStatM(unsigned long &stk, unsigned long &heap, unsigned long &shrd);
    virtual bool plat_getStackUsage(MemUsageResp_t *resp);
    virtual bool plat_getHeapUsage(MemUsageResp_t *resp);
@@ -158,6 +178,7 @@ class linux_process : public sysv_process, public unix_process, public thread_db
 
   protected:
    int computeAddrWidth();
+   bool seized;
 };
 
 class linux_x86_process : public linux_process, public x86_process
@@ -170,6 +191,7 @@ class linux_x86_process : public linux_process, public x86_process
 
    virtual Dyninst::Architecture getTargetArch();
    virtual bool plat_supportHWBreakpoint();
+   virtual bool plat_supportDisplacedStep() const { return true; }
 };
 
 class linux_ppc_process : public linux_process, public ppc_process
@@ -233,6 +255,9 @@ class linux_thread : virtual public thread_db_thread
    static void fake_async_main(void *);
    virtual bool suppressSanityChecks();
 
+   bool canStepOverCountingBreakpoint();
+   bool stepOverCountingBreakpoint(Dyninst::Address addr, int &other_status);
+
    void setGeneratorExiting() { generator_started_exit_processing = true; }
  private:
    ArchEventLinux *postponed_syscall_event;
@@ -0,0 +1,103 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(MPSC_QUEUE_H_)
+#define MPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+
+// Intrusive multi-producer/single-consumer queue (Vyukov).  Producers
+// publish with one atomic exchange and never block; the consumer pops
+// without any atomic read-modify-write.  Mailbox consumers are
+// serialized by the MTManager work lock, which is all "single consumer"
+// requires.
+template <class T>
+class MPSCQueue
+{
+   struct node {
+      std::atomic<node *> next;
+      T val;
+      node() : next(NULL) {}
+      node(const T &v) : next(NULL), val(v) {}
+   };
+
+   std::atomic<node *> head; //Producers push here
+   node *tail;               //Consumer-owned; always a dummy node
+   std::atomic<unsigned long> count;
+
+   MPSCQueue(const MPSCQueue &);
+   MPSCQueue &operator=(const MPSCQueue &);
+public:
+   MPSCQueue() : count(0) {
+      node *stub = new node();
+      head.store(stub);
+      tail = stub;
+   }
+
+   ~MPSCQueue() {
+      T val;
+      while (pop(val)) {}
+      delete tail;
+   }
+
+   void push(const T &val) {
+      node *n = new node(val);
+      count.fetch_add(1, std::memory_order_relaxed);
+      node *prev = head.exchange(n, std::memory_order_acq_rel);
+      prev->next.store(n, std::memory_order_release);
+   }
+
+   //Consumer only.  May transiently report empty while a push is between
+   // its exchange and its link; that push wakes the consumer afterwards.
+   bool pop(T &val) {
+      node *next = tail->next.load(std::memory_order_acquire);
+      if (!next)
+         return false;
+      val = next->val;
+      next->val = T();
+      delete tail;
+      tail = next;
+      count.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+   }
+
+   //Consumer only
+   T front() {
+      node *next = tail->next.load(std::memory_order_acquire);
+      return next ? next->val : T();
+   }
+
+   unsigned long size() const {
+      return count.load(std::memory_order_relaxed);
+   }
+};
+
+#endif
@@ -47,6 +47,10 @@ class x86_process : virtual public int_process
   virtual void plat_breakpointBytes(unsigned char *buffer);
   virtual bool plat_breakpointAdvancesPC() const;
   virtual Address plat_findFreeMemory(size_t) { return 0; }
+  virtual bool plat_createDisplacedStep(Dyninst::Address from, const unsigned char *orig,
+                                        unsigned orig_size, Dyninst::Address to,
+                                        unsigned char *buffer, unsigned &buffer_size,
+                                        unsigned &insn_size);
 };
 
 class x86_thread : virtual public int_thread
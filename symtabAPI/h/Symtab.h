@@ -347,8 +347,11 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
    bool addLinkingResource(Archive *library);
    bool getLinkingResources(std::vector<Archive *> &libs);
+   bool removeLinkingResource(Archive *library);
 
    bool addExternalSymbolReference(Symbol *externalSym, Region *localRegion, relocationEntry localRel);
+   bool addStaticSymbolReference(Symbol *externalSym, Region *localRegion, relocationEntry localRel);
+   bool canLinkStatically(const std::vector<Symbol *> &required, std::string &errMsg);
    bool addTrapHeader_win(Address ptr);
 
    bool updateRelocations(Address start, Address end, Symbol *oldsym, Symbol *newsym);
@@ -630,6 +633,11 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    bool getExplicitSymtabRefs(std::set<Symtab *> &refs);
    std::set<Symtab *> explicitSymtabRefs_;
 
+   // References into linkingResources_ that are resolved by the static
+   // link itself; these never become dynamic relocations
+   bool getStaticSymbolRefs(std::vector<std::pair<Region *, relocationEntry> > &refs);
+   std::vector<std::pair<Region *, relocationEntry> > staticSymbolRefs_;
+
    //type info valid flag
    bool isTypeInfoValid_;
 
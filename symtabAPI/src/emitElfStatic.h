@@ -87,6 +87,7 @@ class emitElfStatic {
     public:
 
     emitElfStatic(unsigned addressWidth, bool isStripped);
+    ~emitElfStatic();
 
     enum StaticLinkError {
         No_Static_Link_Error,
@@ -103,6 +104,11 @@ class emitElfStatic {
                      StaticLinkError &err, 
                      string &errMsg);
 
+    // Checks symbol resolution for a link without performing it
+    bool checkStaticLink(Symtab *target,
+                         StaticLinkError &err,
+                         string &errMsg);
+
     bool resolveSymbols(Symtab *target, 
                         vector<Symtab *> &relocatableObjects, 
                         LinkMap &lmap,
@@ -153,6 +159,9 @@ class emitElfStatic {
 
     Offset computePadding(Offset candidateOffset, Offset alignment);
 
+    // Dynamic targets: a Symbol at the target's PLT entry for an import
+    Symbol *findTargetPLTSymbol(Symtab *target, const string &name);
+
     /**
      * Architecture specific
      *
@@ -396,6 +405,9 @@ class emitElfStatic {
     bool isStripped_;
     bool hasRewrittenTLS_;
 
+    // Cache for findTargetPLTSymbol, including misses
+    std::map<string, Symbol *> pltSymbols_;
+
     typedef boost::tuple<Offset, Offset, Offset> TOCstub;
     std::map<Symbol *, TOCstub> stubMap;
     Offset getStubOffset(TOCstub &t) { return boost::get<0>(t); }